@@ -19,6 +19,7 @@
 #include <geometry/polygon/polygon.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 #include <traffic_simulator_msgs/msg/bounding_box.hpp>
+#include <utility>
 #include <vector>
 
 namespace math
@@ -28,6 +29,14 @@ namespace geometry
 bool checkCollision2D(
   geometry_msgs::msg::Pose pose0, traffic_simulator_msgs::msg::BoundingBox bbox0,
   geometry_msgs::msg::Pose pose1, traffic_simulator_msgs::msg::BoundingBox bbox1);
+/**
+ * @brief Get every pair of bounding boxes colliding with each other, as checkCollision2D does.
+ * Candidates are found by sweep and prune over the axis-aligned bounds of the boxes.
+ * @return Pairs of indices (i, j) of poses and bboxes with i < j, in ascending order.
+ */
+std::vector<std::pair<std::size_t, std::size_t>> getCollidingPairs(
+  const std::vector<geometry_msgs::msg::Pose> & poses,
+  const std::vector<traffic_simulator_msgs::msg::BoundingBox> & bboxes);
 bool contains(
   const std::vector<geometry_msgs::msg::Point> & polygon, const geometry_msgs::msg::Point & point);
 }  // namespace geometry
@@ -41,7 +41,9 @@ public:
   const std::vector<geometry_msgs::msg::Point> getTrajectory(
     double start_s, double end_s, double resolution, double offset = 0.0) const;
   boost::optional<double> getSValue(
-    const geometry_msgs::msg::Pose & pose, double threshold_distance = 3.0);
+    const geometry_msgs::msg::Pose & pose, double threshold_distance = 3.0) const;
+  std::vector<boost::optional<double>> getSValues(
+    const std::vector<geometry_msgs::msg::Pose> & poses, double threshold_distance = 3.0) const;
   double getSquaredDistanceIn2D(const geometry_msgs::msg::Point & point, double s) const;
   geometry_msgs::msg::Vector3 getSquaredDistanceVector(
     const geometry_msgs::msg::Point & point, double s) const;
@@ -66,11 +68,16 @@ private:
   double getSInSplineCurve(size_t curve_index, double s) const;
   std::pair<size_t, double> getCurveIndexAndS(double s) const;
   bool checkConnection() const;
+  bool mayCollideIn2D(
+    size_t curve_index, const geometry_msgs::msg::Point & point0,
+    const geometry_msgs::msg::Point & point1) const;
   bool equals(geometry_msgs::msg::Point p0, geometry_msgs::msg::Point p1) const;
 
   std::vector<HermiteCurve> curves_;
   std::vector<double> length_list_;
+  std::vector<double> accumulated_length_list_;
   std::vector<double> maximum_2d_curvatures_;
+  std::vector<std::pair<geometry_msgs::msg::Point, geometry_msgs::msg::Point>> bounding_boxes_;
   double total_length_;
   const std::vector<geometry_msgs::msg::Point> control_points;
 };
@@ -20,6 +20,7 @@
 #include <geometry/spline/catmull_rom_spline_interface.hpp>
 #include <geometry/spline/hermite_curve.hpp>
 #include <geometry_msgs/msg/point.hpp>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -39,6 +40,10 @@ public:
 
   double getLength() const override;
 
+  const std::shared_ptr<math::geometry::CatmullRomSpline> & getSpline() const { return spline_; }
+  double getStartS() const { return start_s_; }
+  double getEndS() const { return end_s_; }
+
   boost::optional<double> getCollisionPointIn2D(
     const std::vector<geometry_msgs::msg::Point> & polygon, bool search_backward = false,
     bool close_start_end = true) const override;
@@ -23,6 +23,8 @@
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 #include <geometry_msgs/msg/vector3.hpp>
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace math
@@ -56,6 +58,8 @@ public:
   double getMaximum2DCurvature() const;
   double getLength(size_t num_points) const;
   double getLength() const { return length_; }
+  double getArcLength(double t) const;
+  double getCurveParameter(double s) const;
   boost::optional<double> getSValue(
     const geometry_msgs::msg::Pose & pose, double threshold_distance = 3.0,
     bool autoscale = false) const;
@@ -69,9 +73,17 @@ public:
   boost::optional<double> getCollisionPointIn2D(
     const std::vector<geometry_msgs::msg::Point> & polygon, bool search_backward = false,
     bool close_start_end = true) const;
+  std::pair<geometry_msgs::msg::Point, geometry_msgs::msg::Point> get2DBoundingBox() const;
 
 private:
   std::pair<double, double> get2DMinMaxCurvatureValue() const;
+  std::vector<double> getAccumulatedLengths(size_t num_points) const;
+  const std::vector<double> & getAccumulatedLengths() const;
+  /**
+   * @brief arc length table, built by the first conversion between arc length and curve parameter
+   * and shared by copies, so curves which are never sampled by arc length do not allocate it.
+   */
+  mutable std::shared_ptr<const std::vector<double>> accumulated_lengths_;
   double length_;
 };
 }  // namespace geometry
@@ -14,6 +14,7 @@
 
 #include <quaternion_operation/quaternion_operation.h>
 
+#include <algorithm>
 #include <boost/assert.hpp>
 #include <boost/assign/list_of.hpp>
 #include <boost/geometry.hpp>
@@ -22,32 +23,124 @@
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <geometry/bounding_box.hpp>
 #include <geometry/intersection/collision.hpp>
+#include <limits>
+#include <numeric>
+#include <scenario_simulator_exception/exception.hpp>
+#include <utility>
 #include <vector>
 
 namespace math
 {
 namespace geometry
 {
+namespace
+{
+struct OrientedBox
+{
+  std::vector<geometry_msgs::msg::Point> corners;
+  double center_z;
+  double height;
+  double min_x;
+  double max_x;
+  double min_y;
+  double max_y;
+};
+
+OrientedBox toOrientedBox(
+  const geometry_msgs::msg::Pose & pose, const traffic_simulator_msgs::msg::BoundingBox & bbox)
+{
+  OrientedBox box;
+  box.corners = transformPoints(pose, getPointsFromBbox(bbox));
+  box.center_z = pose.position.z + bbox.center.z;
+  box.height = bbox.dimensions.z;
+  const auto [min_x, max_x] = std::minmax_element(
+    box.corners.begin(), box.corners.end(), [](auto && a, auto && b) { return a.x < b.x; });
+  const auto [min_y, max_y] = std::minmax_element(
+    box.corners.begin(), box.corners.end(), [](auto && a, auto && b) { return a.y < b.y; });
+  box.min_x = min_x->x;
+  box.max_x = max_x->x;
+  box.min_y = min_y->y;
+  box.max_y = max_y->y;
+  return box;
+}
+
+// Separating axis test on the normals of the edges of polygon0.
+bool hasSeparatingAxis(
+  const std::vector<geometry_msgs::msg::Point> & polygon0,
+  const std::vector<geometry_msgs::msg::Point> & polygon1)
+{
+  for (std::size_t i = 0; i < polygon0.size(); ++i) {
+    const auto & p0 = polygon0[i];
+    const auto & p1 = polygon0[(i + 1) % polygon0.size()];
+    const double normal_x = p0.y - p1.y;
+    const double normal_y = p1.x - p0.x;
+    const auto project = [&](const auto & polygon) {
+      double min = std::numeric_limits<double>::max();
+      double max = std::numeric_limits<double>::lowest();
+      for (const auto & point : polygon) {
+        const double projection = point.x * normal_x + point.y * normal_y;
+        min = std::min(min, projection);
+        max = std::max(max, projection);
+      }
+      return std::make_pair(min, max);
+    };
+    const auto [min0, max0] = project(polygon0);
+    const auto [min1, max1] = project(polygon1);
+    if (max0 < min1 or max1 < min0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool checkCollision2D(const OrientedBox & box0, const OrientedBox & box1)
+{
+  if (std::abs(box0.center_z - box1.center_z) > std::abs(box0.height + box1.height) * 0.5) {
+    return false;
+  }
+  return not hasSeparatingAxis(box0.corners, box1.corners) and
+         not hasSeparatingAxis(box1.corners, box0.corners);
+}
+}  // namespace
+
 bool checkCollision2D(
   geometry_msgs::msg::Pose pose0, traffic_simulator_msgs::msg::BoundingBox bbox0,
   geometry_msgs::msg::Pose pose1, traffic_simulator_msgs::msg::BoundingBox bbox1)
 {
-  double z_diff_pose =
-    std::abs((pose0.position.z + bbox0.center.z) - (pose1.position.z + bbox1.center.z));
-  if (z_diff_pose > (std::abs(bbox0.dimensions.z + bbox1.dimensions.z) * 0.5)) {
-    return false;
+  return checkCollision2D(toOrientedBox(pose0, bbox0), toOrientedBox(pose1, bbox1));
+}
+
+std::vector<std::pair<std::size_t, std::size_t>> getCollidingPairs(
+  const std::vector<geometry_msgs::msg::Pose> & poses,
+  const std::vector<traffic_simulator_msgs::msg::BoundingBox> & bboxes)
+{
+  if (poses.size() != bboxes.size()) {
+    THROW_SIMULATION_ERROR(
+      "sizes of poses (", poses.size(), ") and bounding boxes (", bboxes.size(), ") differ.");
   }
-  namespace bg = boost::geometry;
-  typedef bg::model::d2::point_xy<double> bg_point;
-  const bg::model::polygon<bg_point> poly0 = math::geometry::get2DPolygon(pose0, bbox0);
-  const bg::model::polygon<bg_point> poly1 = math::geometry::get2DPolygon(pose1, bbox1);
-  if (bg::intersects(poly0, poly1)) {
-    return true;
+  std::vector<OrientedBox> boxes;
+  boxes.reserve(poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    boxes.push_back(toOrientedBox(poses[i], bboxes[i]));
   }
-  if (bg::disjoint(poly0, poly1)) {
-    return false;
+  std::vector<std::size_t> order(boxes.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(), [&](auto a, auto b) {
+    return boxes[a].min_x < boxes[b].min_x;
+  });
+  std::vector<std::pair<std::size_t, std::size_t>> pairs;
+  for (std::size_t i = 0; i < order.size(); ++i) {
+    const auto & box0 = boxes[order[i]];
+    for (std::size_t j = i + 1; j < order.size() and boxes[order[j]].min_x <= box0.max_x; ++j) {
+      const auto & box1 = boxes[order[j]];
+      if (
+        box1.min_y <= box0.max_y and box0.min_y <= box1.max_y and checkCollision2D(box0, box1)) {
+        pairs.emplace_back(std::minmax(order[i], order[j]));
+      }
+    }
   }
-  return true;
+  std::sort(pairs.begin(), pairs.end());
+  return pairs;
 }
 
 bool contains(
@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <geometry/linear_algebra.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
+#include <geometry/transform.hpp>
 #include <iostream>
 #include <limits>
 #include <rclcpp/rclcpp.hpp>
@@ -227,10 +229,12 @@ CatmullRomSpline::CatmullRomSpline(const std::vector<geometry_msgs::msg::Point>
   for (const auto & curve : curves_) {
     length_list_.emplace_back(curve.getLength());
     maximum_2d_curvatures_.emplace_back(curve.getMaximum2DCurvature());
+    bounding_boxes_.emplace_back(curve.get2DBoundingBox());
   }
   total_length_ = 0;
   for (const auto & length : length_list_) {
     total_length_ = total_length_ + length;
+    accumulated_length_list_.emplace_back(total_length_);
   }
   checkConnection();
 }
@@ -244,29 +248,25 @@ std::pair<size_t, double> CatmullRomSpline::getCurveIndexAndS(double s) const
     return std::make_pair(
       curves_.size() - 1, s - (total_length_ - curves_[curves_.size() - 1].getLength()));
   }
-  double current_s = 0;
-  for (size_t i = 0; i < curves_.size(); i++) {
-    double prev_s = current_s;
-    current_s = current_s + length_list_[i];
-    if (prev_s <= s && s < current_s) {
-      return std::make_pair(i, s - prev_s);
-    }
+  /**
+   * @note accumulated_length_list_[i] is the s value at the end of curve i, so the curve containing
+   * s is the first one whose end is greater than s.
+   */
+  const auto iter =
+    std::upper_bound(accumulated_length_list_.begin(), accumulated_length_list_.end(), s);
+  if (iter == accumulated_length_list_.end()) {
+    THROW_SIMULATION_ERROR("failed to calculate curve index");  // LCOV_EXCL_LINE
   }
-  THROW_SIMULATION_ERROR("failed to calculate curve index");  // LCOV_EXCL_LINE
+  const auto index = static_cast<size_t>(iter - accumulated_length_list_.begin());
+  return std::make_pair(index, s - (index == 0 ? 0 : accumulated_length_list_[index - 1]));
 }
 
 double CatmullRomSpline::getSInSplineCurve(size_t curve_index, double s) const
 {
-  size_t n = curves_.size();
-  double ret = 0;
-  for (size_t i = 0; i < n; i++) {
-    if (i == curve_index) {
-      return ret + s;
-    } else {
-      ret = ret + curves_[i].getLength();
-    }
+  if (curve_index >= curves_.size()) {
+    THROW_SEMANTIC_ERROR("curve index does not match");  // LCOV_EXCL_LINE
   }
-  THROW_SEMANTIC_ERROR("curve index does not match");  // LCOV_EXCL_LINE
+  return (curve_index == 0 ? 0 : accumulated_length_list_[curve_index - 1]) + s;
 }
 
 boost::optional<double> CatmullRomSpline::getCollisionPointIn2D(
@@ -319,21 +319,83 @@ boost::optional<double> CatmullRomSpline::getCollisionPointIn2D(
   return boost::none;
 }
 
+/**
+ * @brief checks whether the line segment may intersect with the curve, by comparing the bounding
+ * box of the line segment with the bounding box of the curve computed in the constructor.
+ * Solving the cubic equation is skipped for curves which fail this check.
+ */
+bool CatmullRomSpline::mayCollideIn2D(
+  size_t curve_index, const geometry_msgs::msg::Point & point0,
+  const geometry_msgs::msg::Point & point1) const
+{
+  /**
+   * @note Margin to absorb rounding errors of the intersection calculation.
+   */
+  constexpr double margin = 1e-6;
+  const auto & box = bounding_boxes_[curve_index];
+  return std::max(point0.x, point1.x) + margin >= box.first.x &&
+         std::min(point0.x, point1.x) - margin <= box.second.x &&
+         std::max(point0.y, point1.y) + margin >= box.first.y &&
+         std::min(point0.y, point1.y) - margin <= box.second.y;
+}
+
 boost::optional<double> CatmullRomSpline::getSValue(
-  const geometry_msgs::msg::Pose & pose, double threshold_distance)
+  const geometry_msgs::msg::Pose & pose, double threshold_distance) const
 {
+  geometry_msgs::msg::Point p0, p1;
+  p0.y = threshold_distance;
+  p1.y = -threshold_distance;
+  const auto line = math::geometry::transformPoints(pose, {p0, p1});
   double s = 0;
   for (size_t i = 0; i < curves_.size(); i++) {
-    auto s_value = curves_[i].getSValue(pose, threshold_distance, true);
-    if (s_value) {
-      s = s + s_value.get();
-      return s;
+    if (mayCollideIn2D(i, line[0], line[1])) {
+      const auto s_value = curves_[i].getCollisionPointIn2D(line[0], line[1], false);
+      if (s_value) {
+        return s + curves_[i].getArcLength(s_value.get());
+      }
     }
-    s = s + curves_[i].getLength();
+    s = s + length_list_[i];
   }
   return boost::none;
 }
 
+/**
+ * @brief get s values of many poses at once. The result is the same as calling getSValue for each
+ * pose, but each curve is visited only once and tested against the poses which are not found yet.
+ */
+std::vector<boost::optional<double>> CatmullRomSpline::getSValues(
+  const std::vector<geometry_msgs::msg::Pose> & poses, double threshold_distance) const
+{
+  geometry_msgs::msg::Point p0, p1;
+  p0.y = threshold_distance;
+  p1.y = -threshold_distance;
+  std::vector<std::vector<geometry_msgs::msg::Point>> lines;
+  std::vector<size_t> unresolved;
+  for (size_t i = 0; i < poses.size(); i++) {
+    lines.emplace_back(math::geometry::transformPoints(poses[i], {p0, p1}));
+    unresolved.emplace_back(i);
+  }
+  std::vector<boost::optional<double>> ret(poses.size(), boost::none);
+  double s = 0;
+  for (size_t i = 0; i < curves_.size() && !unresolved.empty(); i++) {
+    const auto resolved = [&](const auto pose_index) {
+      const auto & line = lines[pose_index];
+      if (mayCollideIn2D(i, line[0], line[1])) {
+        const auto s_value = curves_[i].getCollisionPointIn2D(line[0], line[1], false);
+        if (s_value) {
+          ret[pose_index] = s + curves_[i].getArcLength(s_value.get());
+          return true;
+        }
+      }
+      return false;
+    };
+    unresolved.erase(
+      std::remove_if(unresolved.begin(), unresolved.end(), resolved), unresolved.end());
+    s = s + length_list_[i];
+  }
+  return ret;
+}
+
 double CatmullRomSpline::getSquaredDistanceIn2D(
   const geometry_msgs::msg::Point & point, double s) const
 {
@@ -18,6 +18,7 @@
 #include <geometry/spline/hermite_curve.hpp>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <rclcpp/rclcpp.hpp>
 #include <vector>
 
@@ -175,11 +176,39 @@ boost::optional<double> HermiteCurve::getSValue(
     return boost::none;
   }
   if (autoscale) {
-    return s.get() * getLength();
+    return getArcLength(s.get());
   }
   return s.get();
 }
 
+/**
+ * @brief get axis-aligned bounding box of the hermite curve in the x-y plane. The extrema of each
+ * coordinate are either at the end points or at the roots of its derivative, so the box is exact.
+ * @return std::pair<geometry_msgs::msg::Point, geometry_msgs::msg::Point> (min, max) corners
+ */
+std::pair<geometry_msgs::msg::Point, geometry_msgs::msg::Point> HermiteCurve::get2DBoundingBox()
+  const
+{
+  std::vector<double> s_values = {0, 1};
+  for (const auto s : solver_.solveQuadraticEquation(3 * ax_, 2 * bx_, cx_)) {
+    s_values.emplace_back(s);
+  }
+  for (const auto s : solver_.solveQuadraticEquation(3 * ay_, 2 * by_, cy_)) {
+    s_values.emplace_back(s);
+  }
+  geometry_msgs::msg::Point min_point, max_point;
+  min_point.x = min_point.y = std::numeric_limits<double>::max();
+  max_point.x = max_point.y = std::numeric_limits<double>::lowest();
+  for (const auto s : s_values) {
+    const auto point = getPoint(s);
+    min_point.x = std::min(min_point.x, point.x);
+    min_point.y = std::min(min_point.y, point.y);
+    max_point.x = std::max(max_point.x, point.x);
+    max_point.y = std::max(max_point.y, point.y);
+  }
+  return std::make_pair(min_point, max_point);
+}
+
 const std::vector<geometry_msgs::msg::Point> HermiteCurve::getTrajectory(
   double start_s, double end_s, double resolution, bool autoscale) const
 {
@@ -216,7 +245,7 @@ std::vector<geometry_msgs::msg::Point> HermiteCurve::getTrajectory(size_t num_po
 const geometry_msgs::msg::Vector3 HermiteCurve::getNormalVector(double s, bool autoscale) const
 {
   if (autoscale) {
-    s = s / getLength();
+    s = getCurveParameter(s);
   }
   geometry_msgs::msg::Vector3 tangent_vec = getTangentVector(s);
   double theta = M_PI / 2.0;
@@ -229,7 +258,7 @@ const geometry_msgs::msg::Vector3 HermiteCurve::getNormalVector(double s, bool a
 const geometry_msgs::msg::Vector3 HermiteCurve::getTangentVector(double s, bool autoscale) const
 {
   if (autoscale) {
-    s = s / getLength();
+    s = getCurveParameter(s);
   }
   geometry_msgs::msg::Vector3 vec;
   vec.x = 3 * ax_ * s * s + 2 * bx_ * s + cx_;
@@ -241,7 +270,7 @@ const geometry_msgs::msg::Vector3 HermiteCurve::getTangentVector(double s, bool
 const geometry_msgs::msg::Pose HermiteCurve::getPose(double s, bool autoscale) const
 {
   if (autoscale) {
-    s = s / getLength();
+    s = getCurveParameter(s);
   }
   geometry_msgs::msg::Pose pose;
   geometry_msgs::msg::Vector3 tangent_vec = getTangentVector(s, false);
@@ -257,7 +286,7 @@ const geometry_msgs::msg::Pose HermiteCurve::getPose(double s, bool autoscale) c
 double HermiteCurve::get2DCurvature(double s, bool autoscale) const
 {
   if (autoscale) {
-    s = s / getLength();
+    s = getCurveParameter(s);
   }
   double s2 = s * s;
   double x_dot = 3 * ax_ * s2 + 2 * bx_ * s + cx_;
@@ -315,10 +344,85 @@ double HermiteCurve::getLength(size_t num_points) const
   return ret;
 }
 
+/**
+ * @brief get arc length table of the hermite curve.
+ * @param num_points number of sections the curve parameter range [0, 1] is divided into
+ * @return std::vector<double> arc length from the start point at t = i / num_points for each i
+ */
+std::vector<double> HermiteCurve::getAccumulatedLengths(size_t num_points) const
+{
+  double delta_s = 1.0 / num_points;
+  std::vector<double> ret = {0.0};
+  for (size_t i = 0; i < num_points; i++) {
+    double s = i * delta_s;
+    double x_diff = (3 * s * s) * ax_ + 2 * s * bx_ + cx_;
+    double y_diff = (3 * s * s) * ay_ + 2 * s * by_ + cy_;
+    double z_diff = (3 * s * s) * az_ + 2 * s * bz_ + cz_;
+    ret.emplace_back(
+      ret.back() + std::sqrt(x_diff * x_diff + y_diff * y_diff + z_diff * z_diff) * delta_s);
+  }
+  return ret;
+}
+
+/**
+ * @brief get arc length table of the hermite curve with the same samples as getLength(), building
+ * it on the first call. Concurrent first calls may each build a table, but only one is kept.
+ */
+const std::vector<double> & HermiteCurve::getAccumulatedLengths() const
+{
+  if (const auto table = std::atomic_load(&accumulated_lengths_)) {
+    return *table;
+  }
+  auto expected = std::shared_ptr<const std::vector<double>>();
+  std::atomic_compare_exchange_strong(
+    &accumulated_lengths_, &expected,
+    std::make_shared<const std::vector<double>>(getAccumulatedLengths(100)));
+  return *std::atomic_load(&accumulated_lengths_);
+}
+
+/**
+ * @brief convert curve parameter t to arc length from the start point, interpolating the arc length
+ * table. Values outside of [0, 1] are scaled linearly.
+ */
+double HermiteCurve::getArcLength(double t) const
+{
+  if (t <= 0 || t >= 1) {
+    return t * length_;
+  }
+  const auto & accumulated_lengths = getAccumulatedLengths();
+  const auto num_sections = accumulated_lengths.size() - 1;
+  const auto position = t * num_sections;
+  const auto index = std::min(static_cast<size_t>(position), num_sections - 1);
+  return accumulated_lengths[index] +
+         (accumulated_lengths[index + 1] - accumulated_lengths[index]) * (position - index);
+}
+
+/**
+ * @brief convert arc length from the start point to curve parameter t, by binary search over the
+ * arc length table. Unlike s / length, this is accurate even if the speed along the curve varies.
+ * Values outside of [0, length] are scaled linearly.
+ */
+double HermiteCurve::getCurveParameter(double s) const
+{
+  if (s <= 0 || s >= length_) {
+    return s / length_;
+  }
+  const auto & accumulated_lengths = getAccumulatedLengths();
+  const auto num_sections = accumulated_lengths.size() - 1;
+  const auto index = std::min(
+    static_cast<size_t>(
+      std::upper_bound(accumulated_lengths.begin(), accumulated_lengths.end(), s) -
+      accumulated_lengths.begin() - 1),
+    num_sections - 1);
+  const auto section_length = accumulated_lengths[index + 1] - accumulated_lengths[index];
+  const auto ratio = section_length > 0 ? (s - accumulated_lengths[index]) / section_length : 0.0;
+  return (index + ratio) / num_sections;
+}
+
 const geometry_msgs::msg::Point HermiteCurve::getPoint(double s, bool autoscale) const
 {
   if (autoscale) {
-    s = s / getLength();
+    s = getCurveParameter(s);
   }
   geometry_msgs::msg::Point p;
 
@@ -125,6 +125,22 @@ TEST(CatmullRomSpline, GetPoint)
   EXPECT_DOUBLE_EQ(point.z, 0);
 }
 
+TEST(CatmullRomSpline, GetPointWithUnevenControlPoints)
+{
+  geometry_msgs::msg::Point p0;
+  geometry_msgs::msg::Point p1;
+  p1.x = 1;
+  geometry_msgs::msg::Point p2;
+  p2.x = 2;
+  geometry_msgs::msg::Point p3;
+  p3.x = 4;
+  auto points = {p0, p1, p2, p3};
+  auto spline = math::geometry::CatmullRomSpline(points);
+  EXPECT_DECIMAL_EQ(spline.getPoint(1.5).x, 1.5, 0.02);
+  EXPECT_DECIMAL_EQ(spline.getPoint(3).x, 3, 0.02);
+  EXPECT_DECIMAL_EQ(spline.getPoint(3.5).x, 3.5, 0.02);
+}
+
 TEST(CatmullRomSpline, GetSValue)
 {
   geometry_msgs::msg::Point p0;
@@ -150,6 +166,39 @@ TEST(CatmullRomSpline, GetSValue)
   EXPECT_FALSE(spline.getSValue(p, 3));
 }
 
+TEST(CatmullRomSpline, GetSValues)
+{
+  geometry_msgs::msg::Point p0;
+  geometry_msgs::msg::Point p1;
+  p1.x = 1;
+  geometry_msgs::msg::Point p2;
+  p2.x = 2;
+  geometry_msgs::msg::Point p3;
+  p3.x = 4;
+  auto points = {p0, p1, p2, p3};
+  auto spline = math::geometry::CatmullRomSpline(points);
+  std::vector<geometry_msgs::msg::Pose> poses(3);
+  poses[0].position.x = 3;
+  poses[1].position.x = 10;
+  poses[2].position.x = 0.1;
+  poses[2].position.y = 1;
+  const auto result = spline.getSValues(poses, 3);
+  ASSERT_EQ(result.size(), poses.size());
+  EXPECT_TRUE(result[0]);
+  EXPECT_FALSE(result[1]);
+  EXPECT_TRUE(result[2]);
+  for (size_t i = 0; i < poses.size(); i++) {
+    const auto expected = spline.getSValue(poses[i], 3);
+    EXPECT_EQ(static_cast<bool>(result[i]), static_cast<bool>(expected));
+    if (result[i] && expected) {
+      EXPECT_DOUBLE_EQ(result[i].get(), expected.get());
+    }
+  }
+  if (result[2]) {
+    EXPECT_DECIMAL_EQ(result[2].get(), 0.1, 0.001);
+  }
+}
+
 TEST(CatmullRomSpline, GetTrajectory)
 {
   geometry_msgs::msg::Point p0;
@@ -13,9 +13,13 @@
 // limitations under the License.
 
 #include <gtest/gtest.h>
+#include <quaternion_operation/quaternion_operation.h>
 
+#include <cmath>
 #include <geometry/intersection/collision.hpp>
 #include <scenario_simulator_exception/exception.hpp>
+#include <utility>
+#include <vector>
 
 TEST(Collision, DifferentHeight)
 {
@@ -52,6 +56,43 @@ TEST(Collision, SameHeightNoCollision)
   EXPECT_FALSE(math::geometry::checkCollision2D(pose0, box, pose1, box));
 }
 
+TEST(Collision, RotatedNoCollision)
+{
+  geometry_msgs::msg::Pose pose0;
+  geometry_msgs::msg::Pose pose1;
+  traffic_simulator_msgs::msg::BoundingBox box;
+  box.dimensions.x = 2.0;
+  box.dimensions.y = 2.0;
+  box.dimensions.z = 1.0;
+  geometry_msgs::msg::Vector3 rpy;
+  rpy.z = M_PI * 0.25;
+  pose0.orientation = quaternion_operation::convertEulerAngleToQuaternion(rpy);
+  pose1.position.x = 2.3;
+  pose1.position.y = 1.3;
+  EXPECT_FALSE(math::geometry::checkCollision2D(pose0, box, pose1, box));
+  pose1.position.y = 0.0;
+  EXPECT_TRUE(math::geometry::checkCollision2D(pose0, box, pose1, box));
+}
+
+TEST(Collision, CollidingPairs)
+{
+  traffic_simulator_msgs::msg::BoundingBox box;
+  box.dimensions.x = 1.0;
+  box.dimensions.y = 1.0;
+  box.dimensions.z = 1.0;
+  std::vector<geometry_msgs::msg::Pose> poses(4);
+  poses[0].position.x = 10.0;
+  poses[1].position.x = 0.0;
+  poses[2].position.x = 10.5;
+  poses[3].position.x = 0.5;
+  poses[3].position.z = 30.0;
+  const auto pairs = math::geometry::getCollidingPairs(
+    poses, std::vector<traffic_simulator_msgs::msg::BoundingBox>(poses.size(), box));
+  ASSERT_EQ(pairs.size(), static_cast<std::size_t>(1));
+  EXPECT_EQ(pairs[0], std::make_pair(std::size_t(0), std::size_t(2)));
+  EXPECT_THROW(math::geometry::getCollidingPairs(poses, {box}), common::SimulationError);
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
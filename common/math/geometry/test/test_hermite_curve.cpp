@@ -15,6 +15,8 @@
 #include <gtest/gtest.h>
 
 #include <geometry/spline/hermite_curve.hpp>
+#include <thread>
+#include <vector>
 
 TEST(HermiteCurveTest, CheckCollisionToLine)
 {
@@ -76,6 +78,59 @@ TEST(HermiteCurveTest, CheckCollisionToLine)
   }
 }
 
+TEST(HermiteCurveTest, Get2DBoundingBox)
+{
+  geometry_msgs::msg::Pose start_pose, goal_pose;
+  geometry_msgs::msg::Vector3 start_vec, goal_vec;
+  goal_pose.position.x = 1;
+  start_vec.y = 1;
+  goal_vec.y = -1;
+  math::geometry::HermiteCurve curve(start_pose, goal_pose, start_vec, goal_vec);
+  const auto box = curve.get2DBoundingBox();
+  EXPECT_DOUBLE_EQ(box.first.x, 0);
+  EXPECT_DOUBLE_EQ(box.first.y, 0);
+  EXPECT_DOUBLE_EQ(box.second.x, 1);
+  EXPECT_DOUBLE_EQ(box.second.y, 0.25);
+}
+
+TEST(HermiteCurveTest, ArcLengthParameterization)
+{
+  geometry_msgs::msg::Pose start_pose, goal_pose;
+  geometry_msgs::msg::Vector3 start_vec, goal_vec;
+  goal_pose.position.x = 1;
+  math::geometry::HermiteCurve curve(start_pose, goal_pose, start_vec, goal_vec);
+  EXPECT_NEAR(curve.getLength(), 1, 0.001);
+  EXPECT_NEAR(curve.getPoint(curve.getLength() * 0.25, true).x, 0.25, 0.01);
+  EXPECT_NEAR(curve.getPoint(curve.getLength() * 0.75, true).x, 0.75, 0.01);
+  for (const auto s : {0.0, 0.1, 0.3, 0.5, 0.9, curve.getLength()}) {
+    EXPECT_NEAR(curve.getArcLength(curve.getCurveParameter(s)), s, 1e-9);
+  }
+}
+
+TEST(HermiteCurveTest, ArcLengthTableBuiltOnFirstUse)
+{
+  geometry_msgs::msg::Pose start_pose, goal_pose;
+  geometry_msgs::msg::Vector3 start_vec, goal_vec;
+  goal_pose.position.x = 1;
+  goal_pose.position.y = 1;
+  start_vec.x = 3;
+  goal_vec.y = 1;
+  const math::geometry::HermiteCurve curve(start_pose, goal_pose, start_vec, goal_vec);
+  const auto copy = curve;
+  std::vector<double> parameters(8);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < parameters.size(); ++i) {
+    threads.emplace_back([&, i] { parameters[i] = curve.getCurveParameter(0.5); });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  for (const auto parameter : parameters) {
+    EXPECT_DOUBLE_EQ(parameter, copy.getCurveParameter(0.5));
+  }
+  EXPECT_NEAR(curve.getArcLength(parameters.front()), 0.5, 1e-9);
+}
+
 TEST(HermiteCurveTest, getNewtonMethodStepSize) {}
 
 TEST(HermiteCurveTest, CheckNormalVector)
@@ -64,6 +64,8 @@ private:
       configuration.scenario_path = scenario_filename;
       configuration.verbose = verbose;
       configuration.initialize_duration = 0;
+      configuration.transport_protocol = simulation_interface::toTransportProtocol(
+        declare_parameter<std::string>("transport_protocol", "tcp"));
     }
     checkConfiguration(configuration);
     return configuration;
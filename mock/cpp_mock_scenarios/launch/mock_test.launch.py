@@ -77,13 +77,20 @@ def generate_launch_description():
     scenario_package = LaunchConfiguration("package", default="cpp_mock_scenarios")
     junit_path = LaunchConfiguration("junit_path", default="/tmp/output.xunit.xml")
     launch_rviz = LaunchConfiguration("launch_rviz", default=False)
+    transport_protocol = LaunchConfiguration("transport_protocol", default="tcp")
     scenario_node = Node(
         package=scenario_package,
         executable=scenario,
         name=scenario,
         output="screen",
         arguments=[("__log_level:=info")],
-        parameters=[{"junit_path": junit_path, "timeout": timeout}],
+        parameters=[
+            {
+                "junit_path": junit_path,
+                "timeout": timeout,
+                "transport_protocol": transport_protocol,
+            }
+        ],
     )
     io_handler = OnProcessIO(
         target_action=scenario_node,
@@ -116,6 +123,11 @@ def generate_launch_description():
                 default_value=launch_rviz,
                 description="If true, launch with rviz.",
             ),
+            DeclareLaunchArgument(
+                "transport_protocol",
+                default_value=transport_protocol,
+                description="Transport between the scenario and the simulator, tcp or ipc.",
+            ),
             scenario_node,
             RegisterEventHandler(event_handler=io_handler),
             RegisterEventHandler(event_handler=shutdown_handler),
@@ -125,6 +137,7 @@ def generate_launch_description():
                 name="simple_sensor_simulator_node",
                 output="log",
                 arguments=[("__log_level:=warn")],
+                parameters=[{"transport_protocol": transport_protocol}],
             ),
             Node(
                 package="openscenario_visualization",
@@ -17,15 +17,18 @@
 
 #include <boost/variant.hpp>
 #include <chrono>
+#include <cstdint>
 #include <lifecycle_msgs/msg/state.hpp>
 #include <lifecycle_msgs/msg/transition.hpp>
 #include <memory>
+#include <nlohmann/json.hpp>
 #include <openscenario_interpreter/console/escape_sequence.hpp>
 #include <openscenario_interpreter/simulator_core.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
 #include <openscenario_interpreter/syntax/scenario_definition.hpp>
 #include <openscenario_interpreter/utility/execution_timer.hpp>
+#include <openscenario_interpreter/utility/json_patch_watcher.hpp>
 #include <openscenario_interpreter/utility/visibility.hpp>
 #include <openscenario_interpreter_msgs/msg/context.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -50,6 +53,18 @@ class Interpreter : public rclcpp_lifecycle::LifecycleNode,
 
   const rclcpp_lifecycle::LifecyclePublisher<Context>::SharedPtr publisher_of_context;
 
+  bool cache_preprocessed_map;
+
+  bool combine_frame_requests;
+
+  double context_frame_rate;
+
+  int context_snapshot_interval;
+
+  bool entity_status_delta_encoding;
+
+  bool fast_forward;
+
   String intended_result;
 
   double local_frame_rate;
@@ -60,6 +75,10 @@ class Interpreter : public rclcpp_lifecycle::LifecycleNode,
 
   String output_directory;
 
+  bool parallel_npc_update;
+
+  String transport_protocol;
+
   std::shared_ptr<OpenScenario> script;
 
   std::list<std::shared_ptr<ScenarioDefinition>> scenarios;
@@ -72,6 +91,16 @@ class Interpreter : public rclcpp_lifecycle::LifecycleNode,
 
   ExecutionTimer<> execution_timer;
 
+  std::chrono::steady_clock::time_point activation_time;
+
+  JsonPatchWatcher published_context;
+
+  int published_context_patches;
+
+  std::uint64_t published_context_revision;
+
+  std::chrono::steady_clock::time_point published_context_time;
+
   using Result = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
 
 public:
@@ -86,6 +115,10 @@ public:
 
   auto isAnErrorIntended() const -> bool;
 
+  auto isContextPublicationDue() const -> bool;
+
+  auto isFastForwardEnabled() const -> bool;
+
   auto isFailureIntended() const -> bool;
 
   auto isSuccessIntended() const -> bool;
@@ -104,7 +137,7 @@ public:
 
   auto on_shutdown(const rclcpp_lifecycle::State &) -> Result override;
 
-  auto publishCurrentContext() const -> void;
+  auto publishCurrentContext() -> void;
 
   template <typename T, typename... Ts>
   auto set(Ts &&... xs) -> void
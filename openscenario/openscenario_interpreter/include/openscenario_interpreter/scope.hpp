@@ -18,23 +18,38 @@
 #include <boost/filesystem.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/range/algorithm.hpp>
+#include <cstddef>
 #include <functional>
+#include <map>
 #include <memory>
 #include <openscenario_interpreter/name.hpp>
 #include <openscenario_interpreter/syntax/catalog_locations.hpp>
 #include <openscenario_interpreter/syntax/entity_ref.hpp>
 #include <openscenario_interpreter/utility/demangle.hpp>
+#include <typeindex>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 namespace openscenario_interpreter
 {
+class Reference;
+
 class EnvironmentFrame
 {
   friend struct Scope;
 
-  std::multimap<std::string, Object> variables;  // NOTE: must be ordered.
+public:
+  /*
+     Names are interned to integer symbols when they are defined, so looking up
+     a variable compares integers instead of strings.
+  */
+  using Symbol = std::size_t;
+
+  static auto intern(const std::string &) -> Symbol;
+
+private:
+  std::multimap<Symbol, Object> variables;  // NOTE: must be ordered.
 
   EnvironmentFrame * const outer_frame = nullptr;
 
@@ -42,6 +57,8 @@ class EnvironmentFrame
 
   std::vector<EnvironmentFrame *> unnamed_inner_frames;
 
+  static std::size_t generation;  // NOTE: incremented whenever any frame is modified.
+
 #define DEFINE_SYNTAX_ERROR(TYPENAME, ...)                                                       \
   template <typename T>                                                                          \
   struct TYPENAME : public SyntaxError                                                           \
@@ -71,36 +88,7 @@ public:
   template <typename T>
   auto find(const Name & name) const -> Object
   {
-    // NOTE: breadth first search
-    for (std::vector<const EnvironmentFrame *> frames{this}; not frames.empty();) {
-      auto objects = [&]() {
-        std::vector<Object> result;
-        for (auto && frame : frames) {
-          boost::range::for_each(frame->variables.equal_range(name), [&](auto && name_and_value) {
-            return result.push_back(name_and_value.second);
-          });
-        }
-        return result;
-      }();
-
-      switch (boost::range::count_if(objects, is_also<T>())) {
-        case 0:
-          frames = [&]() {
-            std::vector<const EnvironmentFrame *> result;
-            for (auto && current_frame : frames) {
-              boost::range::copy(current_frame->unnamed_inner_frames, std::back_inserter(result));
-            }
-            return result;
-          }();
-          break;
-        case 1:
-          return *boost::range::find_if(objects, is_also<T>());
-        default:
-          throw AmbiguousReferenceTo<T>(name);
-      }
-    }
-
-    return isOutermost() ? throw NoSuchVariableNamed<T>(name) : outer_frame->find<T>(name);
+    return find<T>(intern(name), name);
   }
 
   template <typename T>
@@ -133,9 +121,53 @@ public:
     }
   }
 
+  template <typename T>
+  auto ref(const std::string & reference) const -> Object
+  {
+    return ref<T>(Prefixed<Name>(reference));
+  }
+
+  template <typename T>
+  auto ref(const Reference &) const -> Object;
+
   auto isOutermost() const noexcept -> bool;
 
 private:
+  template <typename T>
+  auto find(Symbol symbol, const Name & name) const -> Object
+  {
+    // NOTE: breadth first search
+    for (std::vector<const EnvironmentFrame *> frames{this}; not frames.empty();) {
+      auto objects = [&]() {
+        std::vector<Object> result;
+        for (auto && frame : frames) {
+          boost::range::for_each(frame->variables.equal_range(symbol), [&](auto && name_and_value) {
+            return result.push_back(name_and_value.second);
+          });
+        }
+        return result;
+      }();
+
+      switch (boost::range::count_if(objects, is_also<T>())) {
+        case 0:
+          frames = [&]() {
+            std::vector<const EnvironmentFrame *> result;
+            for (auto && current_frame : frames) {
+              boost::range::copy(current_frame->unnamed_inner_frames, std::back_inserter(result));
+            }
+            return result;
+          }();
+          break;
+        case 1:
+          return *boost::range::find_if(objects, is_also<T>());
+        default:
+          throw AmbiguousReferenceTo<T>(name);
+      }
+    }
+
+    return isOutermost() ? throw NoSuchVariableNamed<T>(name) : outer_frame->find<T>(symbol, name);
+  }
+
   auto resolvePrefix(const Prefixed<Name> &) const -> std::list<const EnvironmentFrame *>;
 
   auto lookupFrame(const Prefixed<Name> &) const -> const EnvironmentFrame *;
@@ -143,6 +175,48 @@ private:
   auto outermostFrame() const noexcept -> const EnvironmentFrame &;
 };
 
+/*
+   A reference by name (e.g. parameterRef or storyboardElementRef) held by the
+   syntax node which makes it. The name is interned once when the node is
+   read, and the object found through it is kept in the reference itself, so
+   evaluating the reference again at runtime is a direct access as long as no
+   variable or frame has been added since.
+*/
+class Reference : public std::string
+{
+  friend class EnvironmentFrame;
+
+  const bool prefixed;
+
+  const EnvironmentFrame::Symbol symbol;
+
+  mutable const EnvironmentFrame * frame = nullptr;
+
+  mutable std::type_index type = typeid(void);
+
+  mutable std::size_t generation = 0;
+
+  mutable Object object;
+
+public:
+  explicit Reference(const std::string &);
+};
+
+template <typename T>
+auto EnvironmentFrame::ref(const Reference & reference) const -> Object
+{
+  if (
+    not reference.object or reference.frame != this or reference.type != typeid(T) or
+    reference.generation != generation) {
+    reference.object = reference.prefixed ? ref<T>(Prefixed<Name>(reference))
+                                          : find<T>(reference.symbol, Name(reference));
+    reference.frame = this;
+    reference.type = typeid(T);
+    reference.generation = generation;
+  }
+  return reference.object;
+}
+
 inline namespace syntax
 {
 struct Entities;
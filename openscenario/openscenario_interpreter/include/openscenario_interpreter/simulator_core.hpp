@@ -15,6 +15,7 @@
 #ifndef OPENSCENARIO_INTERPRETER__SIMULATOR_CORE_HPP_
 #define OPENSCENARIO_INTERPRETER__SIMULATOR_CORE_HPP_
 
+#include <cstddef>
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 #include <limits>
@@ -24,7 +25,10 @@
 #include <openscenario_interpreter/syntax/double.hpp>
 #include <openscenario_interpreter/syntax/string.hpp>
 #include <openscenario_interpreter/type_traits/requires.hpp>
+#include <openscenario_interpreter/utility/entity_revisions.hpp>
+#include <string>
 #include <traffic_simulator/api/api.hpp>
+#include <traffic_simulator_msgs/msg/entity_status.hpp>
 #include <traffic_simulator_msgs/msg/lanelet_pose.hpp>
 #include <utility>
 
@@ -34,6 +38,19 @@ class SimulatorCore
 {
   static inline std::unique_ptr<traffic_simulator::API> core = nullptr;
 
+  static inline EntityRevisions<traffic_simulator_msgs::msg::EntityStatus> entity_revisions;
+
+  static auto touch() -> void { entity_revisions.touch(); }
+
+  static auto updateEntityRevisions() -> void
+  {
+    entity_revisions.update(core->getEntityNames(), [](const auto & entity_name) {
+      auto entity_status = core->getEntityStatus(entity_name);
+      entity_status.time = 0;  // NOTE: The time stamp changes every frame.
+      return entity_status;
+    });
+  }
+
 public:
   template <typename Node, typename... Ts>
   static auto activate(
@@ -47,9 +64,17 @@ public:
     }
   }
 
-  static auto deactivate() -> void { core.reset(); }
+  static auto deactivate() -> void
+  {
+    core.reset();
+    entity_revisions.clear();
+  }
 
-  static auto update() -> void { core->updateFrame(); }
+  static auto update() -> void
+  {
+    core->updateFrame();
+    updateEntityRevisions();
+  }
 
   class CoordinateSystemConversion
   {
@@ -179,6 +204,7 @@ public:
     template <typename... Ts>
     static auto applyAddEntityAction(Ts &&... xs)
     {
+      touch();
       return core->spawn(std::forward<decltype(xs)>(xs)...);
     }
 
@@ -240,6 +266,7 @@ public:
     template <typename... Ts>
     static auto applyDeleteEntityAction(Ts &&... xs)
     {
+      touch();
       return core->despawn(std::forward<decltype(xs)>(xs)...);
     }
 
@@ -252,12 +279,14 @@ public:
     template <typename... Ts>
     static auto applySpeedAction(Ts &&... xs)
     {
+      touch();
       return core->requestSpeedChange(std::forward<decltype(xs)>(xs)...);
     }
 
     template <typename... Ts>
     static auto applyTeleportAction(Ts &&... xs)
     {
+      touch();
       return core->setEntityStatus(std::forward<decltype(xs)>(xs)...);
     }
 
@@ -284,6 +313,15 @@ public:
       return core->checkCollision(std::forward<decltype(xs)>(xs)...);
     }
 
+    static auto evaluateEntityRevision(const std::string & entity_ref) -> std::size_t
+    {
+      return entity_revisions.of(entity_ref);
+    }
+
+    static auto evaluateLatestEntityRevision() -> std::size_t { return entity_revisions.latest(); }
+
+    static auto evaluateRevision() -> std::size_t { return entity_revisions.current(); }
+
     template <typename... Ts>
     static auto evaluateFreespaceEuclideanDistance(Ts &&... xs)  // for RelativeDistanceCondition
     {
@@ -15,8 +15,11 @@
 #ifndef OPENSCENARIO_INTERPRETER__SYNTAX__BY_ENTITY_CONDITION_HPP_
 #define OPENSCENARIO_INTERPRETER__SYNTAX__BY_ENTITY_CONDITION_HPP_
 
+#include <cstddef>
 #include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/simulator_core.hpp>
 #include <openscenario_interpreter/syntax/entity_condition.hpp>
+#include <openscenario_interpreter/syntax/triggering_entities.hpp>
 #include <pugixml.hpp>
 
 namespace openscenario_interpreter
@@ -33,9 +36,22 @@ inline namespace syntax
  *  </xsd:complexType>
  *
  * -------------------------------------------------------------------------- */
-struct ByEntityCondition : private Scope, public EntityCondition
+struct ByEntityCondition : private Scope,
+                           public EntityCondition,
+                           private SimulatorCore::ConditionEvaluation
 {
+  const TriggeringEntities triggering_entities;
+
+  Object result;
+
+  std::size_t evaluated_revision;
+
   explicit ByEntityCondition(const pugi::xml_node &, Scope &);
+
+  auto evaluate() -> Object;
+
+private:
+  auto dependenciesChanged() const -> bool;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -15,6 +15,7 @@
 #ifndef OPENSCENARIO_INTERPRETER__SYNTAX__CONDITION_HPP_
 #define OPENSCENARIO_INTERPRETER__SYNTAX__CONDITION_HPP_
 
+#include <cstddef>
 #include <nlohmann/json.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/condition_edge.hpp>
@@ -49,6 +50,8 @@ struct Condition : public ComplexType
 
   bool current_value;
 
+  std::size_t evaluation_count;  // the description changes only when this does
+
   explicit Condition(const pugi::xml_node & node, Scope & scope);
 
   auto evaluate() -> Object;
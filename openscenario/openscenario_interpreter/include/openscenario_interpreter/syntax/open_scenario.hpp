@@ -16,10 +16,12 @@
 #define OPENSCENARIO_INTERPRETER__SYNTAX__OPEN_SCENARIO_HPP_
 
 #include <boost/filesystem.hpp>
+#include <memory>
 #include <nlohmann/json.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/file_header.hpp>
 #include <openscenario_interpreter/syntax/open_scenario_category.hpp>
+#include <openscenario_interpreter/utility/json_patch_watcher.hpp>
 #include <pugixml.hpp>
 
 namespace openscenario_interpreter
@@ -40,7 +42,7 @@ struct OpenScenario : public Scope
 {
   const boost::filesystem::path pathname;  // for substitution syntax '$(dirname)'
 
-  pugi::xml_document script;
+  const std::shared_ptr<const pugi::xml_document> script;
 
   const FileHeader file_header;
 
@@ -51,11 +53,12 @@ struct OpenScenario : public Scope
   explicit OpenScenario(const boost::filesystem::path &);
 
   auto evaluate() -> Object;
-
-  auto load(const boost::filesystem::path &) -> const pugi::xml_node &;
 };
 
 auto operator<<(nlohmann::json &, const OpenScenario &) -> nlohmann::json &;
+
+// watches the members of the JSON written by the operator above that change during a scenario
+auto watch(JsonPatchWatcher &, const OpenScenario &) -> void;
 }  // namespace syntax
 }  // namespace openscenario_interpreter
 
@@ -35,7 +35,7 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct ParameterCondition : private Scope
 {
-  const String parameter_ref;
+  const Reference parameter_ref;
 
   const String value;
 
@@ -34,7 +34,7 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct ParameterModifyAction : Scope
 {
-  const String parameter_ref;
+  const Reference parameter_ref;
 
   const ModifyRule rule;
 
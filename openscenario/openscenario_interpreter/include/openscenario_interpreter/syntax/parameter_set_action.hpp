@@ -32,7 +32,7 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct ParameterSetAction : private Scope
 {
-  const String parameter_ref;
+  const Reference parameter_ref;
 
   const String value;
 
@@ -42,7 +42,7 @@ struct ParameterSetAction : private Scope
 
   static auto run() noexcept -> void;
 
-  static auto set(const Scope & scope, const String &, const String &) -> void;
+  static auto set(const Scope & scope, const Reference &, const String &) -> void;
 
   /*  */ auto start() const -> void;
 };
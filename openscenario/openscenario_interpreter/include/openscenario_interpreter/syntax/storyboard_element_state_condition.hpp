@@ -35,7 +35,7 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct StoryboardElementStateCondition : private Scope
 {
-  const String storyboard_element_ref;
+  const Reference storyboard_element_ref;
 
   const StoryboardElementType storyboard_element_type;
 
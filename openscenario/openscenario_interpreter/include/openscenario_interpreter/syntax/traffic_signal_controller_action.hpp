@@ -37,7 +37,7 @@ inline namespace syntax
 struct TrafficSignalControllerAction : public Scope
 {
   // ID of the signal controller in a road network.
-  const String traffic_signal_controller_ref;
+  const Reference traffic_signal_controller_ref;
 
   /*
      Targeted phase of the signal controller. The available phases are defined
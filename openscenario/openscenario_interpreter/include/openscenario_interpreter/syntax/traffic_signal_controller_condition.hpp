@@ -41,7 +41,7 @@ struct TrafficSignalControllerCondition
   const String phase;
 
   // ID of the referenced signal controller in a road network.
-  const String traffic_signal_controller_ref;
+  const Reference traffic_signal_controller_ref;
 
   String current_phase_name;
 
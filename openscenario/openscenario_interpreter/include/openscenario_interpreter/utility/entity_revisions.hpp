@@ -0,0 +1,98 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__UTILITY__ENTITY_REVISIONS_HPP_
+#define OPENSCENARIO_INTERPRETER__UTILITY__ENTITY_REVISIONS_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+/*
+   Revisions are stamps of a counter that is incremented every time the state
+   of some entity changes. A condition remembers the revision at which it was
+   last evaluated, and may skip re-evaluation as long as none of the entities it
+   depends on has a newer revision.
+
+   Entity states are compared once per frame by EntityRevisions::update.
+   Actions that change entity states immediately (in the middle of the
+   storyboard evaluation) call EntityRevisions::touch, so that every entity
+   has a revision at least as new as the touch.
+*/
+template <typename Status>
+class EntityRevisions
+{
+  std::size_t revision = 0;
+
+  std::size_t latest_entity_revision = 0;
+
+  std::size_t touched_revision = 0;
+
+  std::unordered_map<std::string, std::pair<Status, std::size_t>> entities;
+
+  auto advance() -> std::size_t { return latest_entity_revision = ++revision; }
+
+public:
+  auto current() const noexcept { return revision; }
+
+  auto latest() const noexcept { return latest_entity_revision; }
+
+  auto of(const std::string & entity_name) const -> std::size_t
+  {
+    if (const auto iter = entities.find(entity_name); iter != std::end(entities)) {
+      return std::max(iter->second.second, touched_revision);
+    } else {
+      return latest_entity_revision;
+    }
+  }
+
+  auto touch() -> void { touched_revision = advance(); }
+
+  template <typename EntityNames, typename StatusOf>
+  auto update(const EntityNames & entity_names, StatusOf && status_of) -> void
+  {
+    for (auto iter = std::begin(entities); iter != std::end(entities);) {
+      if (
+        std::find(std::begin(entity_names), std::end(entity_names), iter->first) ==
+        std::end(entity_names)) {
+        iter = entities.erase(iter);
+        advance();
+      } else {
+        ++iter;
+      }
+    }
+
+    for (const auto & entity_name : entity_names) {
+      auto status = status_of(entity_name);
+      if (auto iter = entities.find(entity_name); iter == std::end(entities)) {
+        entities.emplace(entity_name, std::make_pair(std::move(status), advance()));
+      } else if (iter->second.first != status) {
+        iter->second = std::make_pair(std::move(status), advance());
+      }
+    }
+  }
+
+  auto clear() -> void { entities.clear(); }
+};
+}  // namespace utility
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__UTILITY__ENTITY_REVISIONS_HPP_
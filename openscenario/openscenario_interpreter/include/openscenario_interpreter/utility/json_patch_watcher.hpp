@@ -0,0 +1,97 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__UTILITY__JSON_PATCH_WATCHER_HPP_
+#define OPENSCENARIO_INTERPRETER__UTILITY__JSON_PATCH_WATCHER_HPP_
+
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+/*
+   Watches the members of a JSON document that may change after it was
+   written, and writes JSON Patch (RFC 6902) operations for the ones that
+   actually changed, without writing or comparing the rest of the document.
+
+   Each member is watched through a key, which is cheap to take and compare,
+   and a value, which is only written when the key changed. For example, the
+   key of the description of a condition is the number of times the condition
+   has been evaluated.
+*/
+class JsonPatchWatcher
+{
+  struct Member
+  {
+    std::string path;
+
+    std::function<bool()> changed;
+
+    std::function<nlohmann::json()> value;
+  };
+
+  std::vector<Member> members;
+
+public:
+  auto empty() const noexcept { return members.empty(); }
+
+  auto clear() -> void { members.clear(); }
+
+  template <typename Key, typename Value>
+  auto watch(const std::string & path, Key && key, Value && value) -> void
+  {
+    members.push_back(Member{
+      path,
+      [key = std::forward<decltype(key)>(key),
+       last = std::optional<std::decay_t<decltype(key())>>()]() mutable {
+        if (auto current = key(); last and *last == current) {
+          return false;
+        } else {
+          last = std::move(current);
+          return true;
+        }
+      },
+      std::forward<decltype(value)>(value)});
+  }
+
+  // takes the current keys as the state of the document that was just written in full
+  auto reset() -> void
+  {
+    for (auto && member : members) {
+      member.changed();
+    }
+  }
+
+  auto diff() -> nlohmann::json
+  {
+    auto patch = nlohmann::json::array();
+    for (auto && member : members) {
+      if (member.changed()) {
+        patch.push_back({{"op", "replace"}, {"path", member.path}, {"value", member.value()}});
+      }
+    }
+    return patch;
+  }
+};
+}  // namespace utility
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__UTILITY__JSON_PATCH_WATCHER_HPP_
@@ -0,0 +1,59 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__UTILITY__XML_DOCUMENT_CACHE_HPP_
+#define OPENSCENARIO_INTERPRETER__UTILITY__XML_DOCUMENT_CACHE_HPP_
+
+#include <boost/filesystem.hpp>
+#include <functional>
+#include <memory>
+#include <pugixml.hpp>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+/*
+   Returns the parsed XML document of the given file.
+
+   Documents are cached keyed by the SHA-256 digest of the content of the
+   file (not by its path or modification time), so re-running an unchanged
+   scenario or re-reading an unchanged catalog skips XML parsing. The syntax
+   tree only reads the document, so the same document can be shared by every
+   run. Only the most recently used documents are kept, so the memory used by
+   the cache does not grow with the number of scenarios run by the process.
+
+   If the file needs to be converted into OpenSCENARIO XML first (e.g. YAML
+   catalogs), the conversion is cached together with the parse result.
+
+   Throws SyntaxError if the file cannot be read or is not well-formed XML.
+*/
+auto loadXmlDocument(
+  const boost::filesystem::path &,
+  const std::function<boost::filesystem::path(const boost::filesystem::path &)> & convert =
+    [](const auto & path) { return path; }) -> std::shared_ptr<const pugi::xml_document>;
+
+/*
+   Same as loadXmlDocument, except that a file which cannot be read or is not
+   well-formed XML yields whatever pugixml parsed from it instead of raising
+   SyntaxError. Errors of the conversion are still raised.
+*/
+auto loadXmlDocumentLeniently(
+  const boost::filesystem::path &,
+  const std::function<boost::filesystem::path(const boost::filesystem::path &)> & convert =
+    [](const auto & path) { return path; }) -> std::shared_ptr<const pugi::xml_document>;
+}  // namespace utility
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__UTILITY__XML_DOCUMENT_CACHE_HPP_
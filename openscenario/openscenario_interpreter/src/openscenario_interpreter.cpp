@@ -33,17 +33,35 @@ namespace openscenario_interpreter
 Interpreter::Interpreter(const rclcpp::NodeOptions & options)
 : rclcpp_lifecycle::LifecycleNode("openscenario_interpreter", options),
   publisher_of_context(create_publisher<Context>("context", rclcpp::QoS(1).transient_local())),
+  cache_preprocessed_map(false),
+  combine_frame_requests(false),
+  context_frame_rate(0),
+  context_snapshot_interval(0),
+  entity_status_delta_encoding(false),
+  fast_forward(false),
   intended_result("success"),
   local_frame_rate(30),
   local_real_time_factor(1.0),
   osc_path(""),
-  output_directory("/tmp")
+  output_directory("/tmp"),
+  parallel_npc_update(false),
+  transport_protocol("tcp"),
+  published_context_patches(0),
+  published_context_revision(0)
 {
+  DECLARE_PARAMETER(cache_preprocessed_map);
+  DECLARE_PARAMETER(combine_frame_requests);
+  DECLARE_PARAMETER(context_frame_rate);
+  DECLARE_PARAMETER(context_snapshot_interval);
+  DECLARE_PARAMETER(entity_status_delta_encoding);
+  DECLARE_PARAMETER(fast_forward);
   DECLARE_PARAMETER(intended_result);
   DECLARE_PARAMETER(local_frame_rate);
   DECLARE_PARAMETER(local_real_time_factor);
   DECLARE_PARAMETER(osc_path);
   DECLARE_PARAMETER(output_directory);
+  DECLARE_PARAMETER(parallel_npc_update);
+  DECLARE_PARAMETER(transport_protocol);
 }
 
 Interpreter::~Interpreter() { SimulatorCore::deactivate(); }
@@ -60,6 +78,26 @@ auto Interpreter::currentScenarioDefinition() const -> const std::shared_ptr<Sce
 
 auto Interpreter::isAnErrorIntended() const -> bool { return intended_result == "error"; }
 
+auto Interpreter::isContextPublicationDue() const -> bool
+{
+  return context_frame_rate <= 0 or
+         std::chrono::duration<double>(std::chrono::steady_clock::now() - published_context_time)
+             .count() >= 1 / context_frame_rate;
+}
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Autoware runs in real time, so fast-forwarding is only possible when no
+ *  entity is controlled by Autoware. Without Autoware, every participant of
+ *  the simulation is stepped by SimulatorCore::update in lockstep, and frames
+ *  can be evaluated back-to-back regardless of the wall clock.
+ *
+ * -------------------------------------------------------------------------- */
+auto Interpreter::isFastForwardEnabled() const -> bool
+{
+  return fast_forward and ObjectController::ego_count == 0;
+}
+
 auto Interpreter::isFailureIntended() const -> bool { return intended_result == "failure"; }
 
 auto Interpreter::isSuccessIntended() const -> bool { return intended_result == "success"; }
@@ -73,11 +111,22 @@ auto Interpreter::makeCurrentConfiguration() const -> traffic_simulator::Configu
   {
     configuration.auto_sink = false;
 
+    configuration.cache_preprocessed_map = cache_preprocessed_map;
+
+    configuration.combine_frame_requests = combine_frame_requests;
+
+    configuration.entity_status_delta_encoding = entity_status_delta_encoding;
+
     configuration.initialize_duration =
       ObjectController::ego_count > 0 ? getParameter<int>("initialize_duration") : 0;
 
+    configuration.parallel_npc_update = parallel_npc_update;
+
     configuration.scenario_path = osc_path;
 
+    configuration.transport_protocol =
+      simulation_interface::toTransportProtocol(transport_protocol);
+
     // XXX DIRTY HACK!!!
     if (not logic_file.isDirectory() and logic_file.filepath.extension() == ".osm") {
       configuration.lanelet2_map_file = logic_file.filepath.filename().string();
@@ -109,11 +158,20 @@ auto Interpreter::on_configure(const rclcpp_lifecycle::State &) -> Result
 
       std::this_thread::sleep_for(std::chrono::seconds(1));  // NOTE: Wait for parameters to be set.
 
+      GET_PARAMETER(cache_preprocessed_map);
+      GET_PARAMETER(combine_frame_requests);
+  GET_PARAMETER(combine_frame_requests);
+      GET_PARAMETER(context_frame_rate);
+      GET_PARAMETER(context_snapshot_interval);
+      GET_PARAMETER(entity_status_delta_encoding);
+      GET_PARAMETER(fast_forward);
       GET_PARAMETER(intended_result);
       GET_PARAMETER(local_frame_rate);
       GET_PARAMETER(local_real_time_factor);
       GET_PARAMETER(osc_path);
       GET_PARAMETER(output_directory);
+      GET_PARAMETER(parallel_npc_update);
+      GET_PARAMETER(transport_protocol);
 
       script = std::make_shared<OpenScenario>(osc_path);
 
@@ -154,12 +212,16 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
       [this]() {
         if (evaluateSimulationTime() < 0) {
           SimulatorCore::update();
-          publishCurrentContext();
+          if (isContextPublicationDue()) {
+            publishCurrentContext();
+          }
         } else if (currentScenarioDefinition()) {
           withTimeoutHandler(defaultTimeoutHandler(), [this]() {
             currentScenarioDefinition()->evaluate();
             SimulatorCore::update();
-            publishCurrentContext();
+            if (isContextPublicationDue()) {
+              publishCurrentContext();
+            }
           });
         } else {
           throw Error("No script evaluable.");
@@ -200,13 +262,32 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
 
         execution_timer.clear();
 
+        published_context.clear();
+
+        published_context_patches = 0;
+
         publisher_of_context->on_activate();
 
         assert(publisher_of_context->is_activated());
 
         initializeStoryboard();
 
-        timer = create_wall_timer(currentLocalFrameRate(), evaluateStoryboard);
+        activation_time = std::chrono::steady_clock::now();
+
+        if (isFastForwardEnabled()) {
+          /*
+             A timer with a period of zero is ready on every spin of the
+             executor, so the next frame is evaluated as soon as the previous
+             one is done while lifecycle transitions are still served.
+          */
+          timer = create_wall_timer(std::chrono::milliseconds(0), evaluateStoryboard);
+        } else {
+          if (fast_forward) {
+            INTERPRETER_INFO_STREAM(
+              "Parameter fast_forward is ignored because Autoware runs in real time.");
+          }
+          timer = create_wall_timer(currentLocalFrameRate(), evaluateStoryboard);
+        }
 
         return Interpreter::Result::SUCCESS;  // => Active
       });
@@ -217,6 +298,15 @@ auto Interpreter::on_deactivate(const rclcpp_lifecycle::State &) -> Result
 {
   timer.reset();  // Stop scenario evaluation
 
+  if (isFastForwardEnabled()) {
+    const auto simulation_time = evaluateSimulationTime();
+    const auto elapsed_time =
+      std::chrono::duration<double>(std::chrono::steady_clock::now() - activation_time).count();
+    INTERPRETER_INFO_STREAM(
+      "Simulated " << simulation_time << " seconds in " << elapsed_time << " seconds ("
+                   << simulation_time / elapsed_time << " times faster than real time).");
+  }
+
   publisher_of_context->on_deactivate();
 
   SimulatorCore::deactivate();
@@ -257,17 +347,53 @@ auto Interpreter::on_shutdown(const rclcpp_lifecycle::State &) -> Result
   return Interpreter::Result::SUCCESS;  // => Finalized
 }
 
-auto Interpreter::publishCurrentContext() const -> void
+auto Interpreter::publishCurrentContext() -> void
 {
   Context context;
   {
-    nlohmann::json json;
     context.stamp = now();
-    context.data = (json << *script).dump();
     context.time = evaluateSimulationTime();
+    context.revision = ++published_context_revision;
+
+    /* ---- NOTE ---------------------------------------------------------------
+     *
+     *  If context_snapshot_interval is positive, only the difference from the
+     *  previously published context is sent as a JSON Patch (RFC 6902), and a
+     *  full snapshot is sent once every context_snapshot_interval messages so
+     *  that late subscribers can catch up. Subscribers must apply a patch only
+     *  to the context of the preceding revision.
+     *
+     *  A patch is made without serializing the storyboard. Only the members
+     *  that change during a scenario (states, execution counts and the values
+     *  of conditions) are compared with the values they had when the previous
+     *  context was published, and a condition is described again only if it
+     *  has been evaluated since then.
+     *
+     * ---------------------------------------------------------------------- */
+    if (
+      0 < context_snapshot_interval and not published_context.empty() and
+      published_context_patches < context_snapshot_interval) {
+      context.type = Context::PATCH;
+      context.data = published_context.diff().dump();
+      ++published_context_patches;
+    } else {
+      nlohmann::json json;
+      json << *script;
+      context.type = Context::SNAPSHOT;
+      context.data = json.dump();
+      published_context_patches = 0;
+      if (0 < context_snapshot_interval) {
+        if (published_context.empty()) {
+          watch(published_context, *script);
+        }
+        published_context.reset();
+      }
+    }
   }
 
   publisher_of_context->publish(context);
+
+  published_context_time = std::chrono::steady_clock::now();
 }
 }  // namespace openscenario_interpreter
 
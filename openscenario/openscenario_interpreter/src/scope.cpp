@@ -23,9 +23,13 @@
 
 namespace openscenario_interpreter
 {
+std::size_t EnvironmentFrame::generation = 0;
+
 EnvironmentFrame::EnvironmentFrame(EnvironmentFrame & outer_frame, const std::string & name)
 : outer_frame(&outer_frame)
 {
+  ++generation;
+
   if (name.empty()) {
     outer_frame.unnamed_inner_frames.push_back(this);
   } else {
@@ -35,7 +39,14 @@ EnvironmentFrame::EnvironmentFrame(EnvironmentFrame & outer_frame, const std::st
 
 auto EnvironmentFrame::define(const Name & name, const Object & object) -> void
 {
-  variables.emplace(name, object);
+  ++generation;
+  variables.emplace(intern(name), object);
+}
+
+auto EnvironmentFrame::intern(const std::string & name) -> Symbol
+{
+  static std::unordered_map<std::string, Symbol> symbols;
+  return symbols.emplace(name, symbols.size()).first->second;
 }
 
 auto EnvironmentFrame::isOutermost() const noexcept -> bool { return outer_frame == nullptr; }
@@ -88,6 +99,13 @@ auto EnvironmentFrame::lookupFrame(const Prefixed<Name> & prefixed_name) const
   }
 }
 
+Reference::Reference(const std::string & name)
+: std::string(name),
+  prefixed(name.find("::") != std::string::npos),
+  symbol(prefixed ? 0 : EnvironmentFrame::intern(name))
+{
+}
+
 Scope::Scope(const OpenScenario * const open_scenario)
 : open_scenario(open_scenario),
   frame(new EnvironmentFrame()),
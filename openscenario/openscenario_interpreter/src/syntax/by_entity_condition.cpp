@@ -12,8 +12,12 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <openscenario_interpreter/reader/element.hpp>
+#include <openscenario_interpreter/syntax/acceleration_condition.hpp>
 #include <openscenario_interpreter/syntax/by_entity_condition.hpp>
+#include <openscenario_interpreter/syntax/speed_condition.hpp>
+#include <openscenario_interpreter/syntax/stand_still_condition.hpp>
 #include <openscenario_interpreter/syntax/triggering_entities.hpp>
 
 namespace openscenario_interpreter
@@ -24,8 +28,42 @@ ByEntityCondition::ByEntityCondition(const pugi::xml_node & node, Scope & scope)
 : Scope(scope),
   EntityCondition(readElement<EntityCondition>(
     "EntityCondition", node, local(),
-    readElement<TriggeringEntities>("TriggeringEntities", node, local())))
+    readElement<TriggeringEntities>("TriggeringEntities", node, local()))),
+  triggering_entities(readElement<TriggeringEntities>("TriggeringEntities", node, local())),
+  result(unspecified),
+  evaluated_revision(0)
 {
 }
+
+auto ByEntityCondition::dependenciesChanged() const -> bool
+{
+  /*
+     SpeedCondition and AccelerationCondition depend only on the states of the
+     triggering entities. StandStillCondition depends on the simulation time,
+     so it must always be re-evaluated. The other conditions compare the
+     triggering entities against other entities or against positions that may
+     be relative to other entities, so they depend on every entity.
+  */
+  if (is<StandStillCondition>()) {
+    return true;
+  } else if (is<SpeedCondition>() or is<AccelerationCondition>()) {
+    return std::any_of(
+      std::begin(triggering_entities.entity_refs), std::end(triggering_entities.entity_refs),
+      [this](auto && entity_ref) {
+        return evaluated_revision < evaluateEntityRevision(entity_ref);
+      });
+  } else {
+    return evaluated_revision < evaluateLatestEntityRevision();
+  }
+}
+
+auto ByEntityCondition::evaluate() -> Object
+{
+  if (result == unspecified or dependenciesChanged()) {
+    evaluated_revision = evaluateRevision();
+    result = EntityCondition::evaluate();
+  }
+  return result;
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -36,7 +36,8 @@ Condition::Condition(const pugi::xml_node & node, Scope & scope)
   name(readAttribute<String>("name", node, scope)),
   delay(readAttribute<Double>("delay", node, scope, Double())),
   condition_edge(readAttribute<ConditionEdge>("conditionEdge", node, scope)),
-  current_value(false)
+  current_value(false),
+  evaluation_count(0)
 // clang-format on
 {
 }
@@ -46,6 +47,7 @@ auto Condition::evaluate() -> Object
   if (condition_edge == ConditionEdge::sticky and current_value) {
     return true_v;
   } else {
+    ++evaluation_count;
     return asBoolean(current_value = Object::evaluate().as<Boolean>());
   }
 }
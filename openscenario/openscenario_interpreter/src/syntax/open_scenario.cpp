@@ -12,10 +12,26 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <boost/lexical_cast.hpp>
+#include <cstddef>
 #include <openscenario_interpreter/reader/element.hpp>
+#include <openscenario_interpreter/syntax/act.hpp>
+#include <openscenario_interpreter/syntax/action.hpp>
+#include <openscenario_interpreter/syntax/boolean.hpp>
+#include <openscenario_interpreter/syntax/condition.hpp>
+#include <openscenario_interpreter/syntax/condition_group.hpp>
+#include <openscenario_interpreter/syntax/event.hpp>
+#include <openscenario_interpreter/syntax/init_actions.hpp>
+#include <openscenario_interpreter/syntax/maneuver.hpp>
+#include <openscenario_interpreter/syntax/maneuver_group.hpp>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
 #include <openscenario_interpreter/syntax/open_scenario_category.hpp>
 #include <openscenario_interpreter/syntax/scenario_definition.hpp>
+#include <openscenario_interpreter/syntax/story.hpp>
+#include <openscenario_interpreter/syntax/storyboard.hpp>
+#include <openscenario_interpreter/syntax/trigger.hpp>
+#include <openscenario_interpreter/utility/xml_document_cache.hpp>
+#include <string>
 
 namespace openscenario_interpreter
 {
@@ -24,8 +40,9 @@ inline namespace syntax
 OpenScenario::OpenScenario(const boost::filesystem::path & pathname)
 : Scope(this),
   pathname(pathname),
-  file_header(readElement<FileHeader>("FileHeader", load(pathname).child("OpenSCENARIO"), local())),
-  category(readElement<OpenScenarioCategory>("OpenSCENARIO", script, local()))
+  script(loadXmlDocument(pathname)),
+  file_header(readElement<FileHeader>("FileHeader", script->child("OpenSCENARIO"), local())),
+  category(readElement<OpenScenarioCategory>("OpenSCENARIO", *script, local()))
 {
 }
 
@@ -35,15 +52,6 @@ auto OpenScenario::evaluate() -> Object
   return category.evaluate();
 }
 
-auto OpenScenario::load(const boost::filesystem::path & filepath) -> const pugi::xml_node &
-{
-  if (const auto result = script.load_file(filepath.string().c_str()); not result) {
-    throw SyntaxError(result.description(), ": ", filepath);
-  } else {
-    return script;
-  }
-}
-
 auto operator<<(nlohmann::json & json, const OpenScenario & datum) -> nlohmann::json &
 {
   json["version"] = "1.0";
@@ -64,5 +72,119 @@ auto operator<<(nlohmann::json & json, const OpenScenario & datum) -> nlohmann::
 
   return json;
 }
+
+auto watch(JsonPatchWatcher & watcher, const OpenScenario & datum) -> void
+{
+  const auto watch_boolean = [&](const std::string & path, const bool & value) {
+    watcher.watch(
+      path, [value = &value]() { return *value; },
+      [value = &value]() { return boost::lexical_cast<std::string>(Boolean(*value)); });
+  };
+
+  const auto watch_count = [&](const std::string & path, const std::size_t & count) {
+    watcher.watch(
+      path, [count = &count]() { return *count; }, [count = &count]() { return *count; });
+  };
+
+  const auto watch_state = [&](const std::string & path, const StoryboardElement & element) {
+    watcher.watch(
+      path + "/currentState",
+      [element = &element]() {
+        return static_cast<StoryboardElementState::value_type>(
+          element->state().as<StoryboardElementState>());
+      },
+      [element = &element]() { return boost::lexical_cast<std::string>(element->state()); });
+  };
+
+  const auto watch_trigger = [&](const std::string & path, const Trigger & trigger) {
+    watch_boolean(path + "/currentValue", trigger.current_value);
+    std::size_t i = 0;
+    for (const auto & condition_group : trigger) {
+      const auto condition_group_path = path + "/ConditionGroup/" + std::to_string(i++);
+      watch_boolean(condition_group_path + "/currentValue", condition_group.current_value);
+      std::size_t j = 0;
+      for (const auto & condition : condition_group) {
+        const auto condition_path = condition_group_path + "/Condition/" + std::to_string(j++);
+        watcher.watch(
+          condition_path + "/currentEvaluation",
+          [condition = &condition]() { return condition->evaluation_count; },
+          [condition = &condition]() { return condition->description(); });
+        watch_boolean(condition_path + "/currentValue", condition.current_value);
+      }
+    }
+  };
+
+  watch_count("/frame", datum.frame);
+
+  // clang-format off
+  for (const auto & [name, state] : {
+         std::make_pair("completeState",   &openscenario_interpreter::complete_state),
+         std::make_pair("runningState",    &openscenario_interpreter::running_state),
+         std::make_pair("standbyState",    &openscenario_interpreter::standby_state),
+         std::make_pair("startTransition", &openscenario_interpreter::start_transition),
+         std::make_pair("stopTransition",  &openscenario_interpreter::stop_transition),
+       }) {
+    watcher.watch(
+      std::string("/CurrentStates/") + name,
+      [state = state]() { return state->use_count() - 1; },
+      [state = state]() { return state->use_count() - 1; });
+  }
+  // clang-format on
+
+  const auto watch_event = [&](const std::string & path, const Event & event) {
+    watch_state(path, event);
+    watch_count(path + "/currentExecutionCount", event.current_execution_count);
+    std::size_t i = 0;
+    for (const auto & action : event.elements) {
+      watch_state(path + "/Action/" + std::to_string(i++), action.as<Action>());
+    }
+    watch_trigger(path + "/StartTrigger", event.start_trigger);
+  };
+
+  const auto watch_maneuver = [&](const std::string & path, const Maneuver & maneuver) {
+    watch_state(path, maneuver);
+    std::size_t i = 0;
+    for (const auto & event : maneuver.elements) {
+      watch_event(path + "/Event/" + std::to_string(i++), event.as<Event>());
+    }
+  };
+
+  const auto watch_maneuver_group = [&](const std::string & path, const ManeuverGroup & group) {
+    watch_state(path, group);
+    watch_count(path + "/currentExecutionCount", group.current_execution_count);
+    std::size_t i = 0;
+    for (const auto & maneuver : group.elements) {
+      watch_maneuver(path + "/Maneuver/" + std::to_string(i++), maneuver.as<Maneuver>());
+    }
+  };
+
+  const auto watch_act = [&](const std::string & path, const Act & act) {
+    watch_state(path, act);
+    std::size_t i = 0;
+    for (const auto & maneuver_group : act.elements) {
+      watch_maneuver_group(
+        path + "/ManeuverGroup/" + std::to_string(i++), maneuver_group.as<ManeuverGroup>());
+    }
+  };
+
+  const auto watch_story = [&](const std::string & path, const Story & story) {
+    watch_state(path, story);
+    std::size_t i = 0;
+    for (const auto & act : story.elements) {
+      watch_act(path + "/Act/" + std::to_string(i++), act.as<Act>());
+    }
+  };
+
+  if (datum.category.is<ScenarioDefinition>()) {
+    const auto & storyboard = datum.category.as<ScenarioDefinition>().storyboard;
+    watch_state("/OpenSCENARIO/Storyboard", storyboard);
+    std::size_t i = 0;
+    for (const auto & story : storyboard.elements) {
+      if (not story.is<InitActions>()) {
+        watch_story("/OpenSCENARIO/Storyboard/Story/" + std::to_string(i++), story.as<Story>());
+      }
+    }
+  }
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -35,7 +35,7 @@ auto ParameterSetAction::accomplished() noexcept -> bool  //
 auto ParameterSetAction::run() noexcept -> void {}
 
 auto ParameterSetAction::set(
-  const Scope & scope, const String & parameter_ref, const String & value) -> void
+  const Scope & scope, const Reference & parameter_ref, const String & value) -> void
 {
   static const std::unordered_map<
     std::type_index, std::function<void(const Object &, const String &)>>
@@ -0,0 +1,120 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <array>
+#include <fstream>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <openscenario_interpreter/error.hpp>
+#include <openscenario_interpreter/utility/xml_document_cache.hpp>
+#include <sodium.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+namespace
+{
+// Number of documents kept by the cache.
+constexpr std::size_t capacity = 64;
+
+struct Entry
+{
+  std::shared_ptr<const pugi::xml_document> document;
+
+  pugi::xml_parse_result result;
+};
+
+auto load(
+  const boost::filesystem::path & path,
+  const std::function<boost::filesystem::path(const boost::filesystem::path &)> & convert)
+  -> Entry
+{
+  static std::mutex mutex;
+
+  // Most recently used first.
+  static std::list<std::pair<std::string, Entry>> entries;
+
+  static std::unordered_map<std::string, decltype(entries)::iterator> index;
+
+  auto key = [&]() -> std::string {
+    if (std::ifstream file(path.string(), std::ios::binary); not file or sodium_init() < 0) {
+      return "";
+    } else {
+      const auto content =
+        std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+      // NOTE: The extension is part of the key because it determines the conversion.
+      const auto extension = path.extension().string() + '\n';
+      crypto_hash_sha256_state state;
+      std::array<unsigned char, crypto_hash_sha256_BYTES> digest;
+      crypto_hash_sha256_init(&state);
+      crypto_hash_sha256_update(
+        &state, reinterpret_cast<const unsigned char *>(extension.data()), extension.size());
+      crypto_hash_sha256_update(
+        &state, reinterpret_cast<const unsigned char *>(content.data()), content.size());
+      crypto_hash_sha256_final(&state, digest.data());
+      return std::string(std::begin(digest), std::end(digest));
+    }
+  }();
+
+  if (key.empty()) {
+    auto document = std::make_shared<pugi::xml_document>();
+    auto result = document->load_file(convert(path).string().c_str());
+    return {document, result};
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  if (const auto iter = index.find(key); iter != std::end(index)) {
+    entries.splice(std::begin(entries), entries, iter->second);
+    return iter->second->second;
+  } else {
+    auto document = std::make_shared<pugi::xml_document>();
+    auto result = document->load_file(convert(path).string().c_str());
+    entries.emplace_front(key, Entry{document, result});
+    index.emplace(std::move(key), std::begin(entries));
+    if (capacity < entries.size()) {
+      index.erase(entries.back().first);
+      entries.pop_back();
+    }
+    return entries.front().second;
+  }
+}
+}  // namespace
+
+auto loadXmlDocument(
+  const boost::filesystem::path & path,
+  const std::function<boost::filesystem::path(const boost::filesystem::path &)> & convert)
+  -> std::shared_ptr<const pugi::xml_document>
+{
+  if (const auto entry = load(path, convert); not entry.result) {
+    throw SyntaxError(entry.result.description(), ": ", path);
+  } else {
+    return entry.document;
+  }
+}
+
+auto loadXmlDocumentLeniently(
+  const boost::filesystem::path & path,
+  const std::function<boost::filesystem::path(const boost::filesystem::path &)> & convert)
+  -> std::shared_ptr<const pugi::xml_document>
+{
+  return load(path, convert).document;
+}
+}  // namespace utility
+}  // namespace openscenario_interpreter
@@ -0,0 +1,110 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <openscenario_interpreter/utility/entity_revisions.hpp>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using openscenario_interpreter::EntityRevisions;
+
+/*
+   Mirrors the way ByEntityCondition uses the revisions: a result evaluated at
+   some revision may be reused while the entity has no newer revision.
+*/
+struct Frame
+{
+  std::unordered_map<std::string, double> speeds;
+
+  auto names() const
+  {
+    std::vector<std::string> names;
+    for (const auto & [name, speed] : speeds) {
+      names.push_back(name);
+    }
+    return names;
+  }
+};
+
+TEST(EntityRevisions, reuseResultWhileEntityUnchanged)
+{
+  EntityRevisions<double> revisions;
+  Frame frame{{{"ego", 1.0}, {"npc", 2.0}}};
+  const auto status_of = [&](const auto & name) { return frame.speeds.at(name); };
+
+  revisions.update(frame.names(), status_of);
+  const auto evaluated_revision = revisions.current();
+
+  revisions.update(frame.names(), status_of);
+  EXPECT_FALSE(evaluated_revision < revisions.of("ego"));
+  EXPECT_FALSE(evaluated_revision < revisions.latest());
+
+  frame.speeds["npc"] = 3.0;
+  revisions.update(frame.names(), status_of);
+  EXPECT_FALSE(evaluated_revision < revisions.of("ego"));
+  EXPECT_TRUE(evaluated_revision < revisions.of("npc"));
+  EXPECT_TRUE(evaluated_revision < revisions.latest());
+}
+
+TEST(EntityRevisions, invalidateResultAfterChangeInFrame)
+{
+  EntityRevisions<double> revisions;
+  Frame frame{{{"ego", 1.0}, {"npc", 2.0}}};
+  const auto status_of = [&](const auto & name) { return frame.speeds.at(name); };
+
+  revisions.update(frame.names(), status_of);
+  const auto evaluated_revision = revisions.current();
+
+  revisions.touch();  // e.g. a step SpeedAction applied to the ego in the middle of the frame.
+  EXPECT_TRUE(evaluated_revision < revisions.of("ego"));
+  EXPECT_TRUE(evaluated_revision < revisions.of("npc"));
+  EXPECT_TRUE(evaluated_revision < revisions.latest());
+
+  const auto reevaluated_revision = revisions.current();
+  EXPECT_FALSE(reevaluated_revision < revisions.of("ego"));
+
+  frame.speeds["ego"] = 10.0;
+  revisions.update(frame.names(), status_of);
+  EXPECT_TRUE(reevaluated_revision < revisions.of("ego"));
+  EXPECT_FALSE(reevaluated_revision < revisions.of("npc"));
+}
+
+TEST(EntityRevisions, invalidateResultOnSpawnAndDespawn)
+{
+  EntityRevisions<double> revisions;
+  Frame frame{{{"ego", 1.0}}};
+  const auto status_of = [&](const auto & name) { return frame.speeds.at(name); };
+
+  revisions.update(frame.names(), status_of);
+  auto evaluated_revision = revisions.current();
+
+  frame.speeds["npc"] = 2.0;
+  revisions.update(frame.names(), status_of);
+  EXPECT_TRUE(evaluated_revision < revisions.of("npc"));
+  EXPECT_TRUE(evaluated_revision < revisions.latest());
+
+  evaluated_revision = revisions.current();
+  frame.speeds.erase("npc");
+  revisions.update(frame.names(), status_of);
+  EXPECT_FALSE(evaluated_revision < revisions.of("ego"));
+  EXPECT_TRUE(evaluated_revision < revisions.latest());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,116 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <nlohmann/json.hpp>
+#include <openscenario_interpreter/utility/json_patch_watcher.hpp>
+#include <string>
+
+using openscenario_interpreter::JsonPatchWatcher;
+
+/*
+   Mirrors the way the interpreter publishes its context: a document written in
+   full, followed by patches made only from the watched members.
+*/
+struct Document
+{
+  std::string name = "condition";
+
+  std::size_t evaluation_count = 0;
+
+  std::size_t description_count = 0;
+
+  bool value = false;
+
+  auto description()
+  {
+    ++description_count;
+    return "evaluated " + std::to_string(evaluation_count) + " times";
+  }
+
+  auto write()
+  {
+    nlohmann::json json;
+    json["name"] = name;
+    json["Condition"]["currentEvaluation"] = description();
+    json["Condition"]["currentValue"] = value;
+    return json;
+  }
+
+  auto watch(JsonPatchWatcher & watcher)
+  {
+    watcher.watch(
+      "/Condition/currentEvaluation", [this]() { return evaluation_count; },
+      [this]() { return description(); });
+    watcher.watch(
+      "/Condition/currentValue", [this]() { return value; }, [this]() { return value; });
+  }
+};
+
+TEST(JsonPatchWatcher, emptyPatchWhileNothingChanged)
+{
+  Document document;
+  JsonPatchWatcher watcher;
+  document.watch(watcher);
+  document.write();
+  watcher.reset();
+  const auto description_count = document.description_count;
+
+  EXPECT_TRUE(watcher.diff().empty());
+  EXPECT_EQ(document.description_count, description_count);
+}
+
+TEST(JsonPatchWatcher, patchReproducesDocument)
+{
+  Document document;
+  JsonPatchWatcher watcher;
+  document.watch(watcher);
+  auto published = document.write();
+  watcher.reset();
+
+  ++document.evaluation_count;
+  document.value = true;
+  auto patch = watcher.diff();
+  EXPECT_EQ(patch.size(), 2u);
+  published = published.patch(patch);
+  EXPECT_EQ(published, document.write());
+
+  ++document.evaluation_count;
+  patch = watcher.diff();
+  EXPECT_EQ(patch.size(), 1u);
+  published = published.patch(patch);
+  EXPECT_EQ(published, document.write());
+}
+
+TEST(JsonPatchWatcher, resetTakesWrittenDocumentAsBase)
+{
+  Document document;
+  JsonPatchWatcher watcher;
+  document.watch(watcher);
+  document.write();
+  watcher.reset();
+
+  ++document.evaluation_count;
+  document.write();
+  watcher.reset();
+  EXPECT_TRUE(watcher.diff().empty());
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,87 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
+
+using openscenario_interpreter::make;
+using openscenario_interpreter::Reference;
+using openscenario_interpreter::Scope;
+using openscenario_interpreter::String;
+
+TEST(Scope, innerDefinitionShadowsOuterOne)
+{
+  Scope global(nullptr);
+  global.insert("x", make<String>("global"));
+  Scope story("story", global);
+  Scope maneuver("maneuver", story);
+  maneuver.insert("x", make<String>("maneuver"));
+
+  const Reference x("x");
+  EXPECT_EQ(maneuver.ref<String>(x), "maneuver");
+  EXPECT_EQ(story.ref<String>(x), "global");
+  EXPECT_EQ(global.ref<String>(x), "global");
+  EXPECT_EQ(maneuver.ref<String>(x), "maneuver");
+}
+
+TEST(Scope, ambiguousReference)
+{
+  Scope global(nullptr);
+  Scope a("", global);
+  Scope b("", global);
+  a.insert("x", make<String>("a"));
+  b.insert("x", make<String>("b"));
+
+  EXPECT_EQ(a.ref<String>(Reference("x")), "a");
+  EXPECT_EQ(b.ref<String>(Reference("x")), "b");
+  EXPECT_THROW(global.ref<String>(Reference("x")), openscenario_interpreter::SyntaxError);
+}
+
+TEST(Scope, prefixedReference)
+{
+  Scope global(nullptr);
+  Scope a("A", global);
+  Scope b("B", global);
+  a.insert("x", make<String>("a"));
+  b.insert("x", make<String>("b"));
+
+  const Reference x("A::x");
+  EXPECT_EQ(b.ref<String>(x), "a");
+  EXPECT_EQ(b.ref<String>(Reference("x")), "b");
+}
+
+TEST(Scope, referenceResolvedAgainAfterDefine)
+{
+  Scope global(nullptr);
+  global.insert("x", make<String>("global"));
+  Scope inner("", global);
+
+  const Reference x("x");
+  EXPECT_EQ(inner.ref<String>(x), "global");
+  inner.insert("x", make<String>("inner"));
+  EXPECT_EQ(inner.ref<String>(x), "inner");
+
+  const Reference y("y");
+  EXPECT_THROW(inner.ref<String>(y), openscenario_interpreter::SyntaxError);
+  global.insert("y", make<String>("global"));
+  EXPECT_EQ(inner.ref<String>(y), "global");
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
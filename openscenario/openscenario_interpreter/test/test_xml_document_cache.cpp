@@ -0,0 +1,120 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <cstddef>
+#include <fstream>
+#include <openscenario_interpreter/error.hpp>
+#include <openscenario_interpreter/utility/xml_document_cache.hpp>
+#include <string>
+
+using openscenario_interpreter::loadXmlDocument;
+using openscenario_interpreter::loadXmlDocumentLeniently;
+
+/*
+   The cache is shared by every test of this file, so each test writes
+   content no other test writes.
+*/
+class XmlDocumentCache : public testing::Test
+{
+protected:
+  const boost::filesystem::path directory =
+    boost::filesystem::temp_directory_path() / boost::filesystem::unique_path();
+
+  void SetUp() override { boost::filesystem::create_directories(directory); }
+
+  void TearDown() override { boost::filesystem::remove_all(directory); }
+
+  auto write(const std::string & filename, const std::string & content) const
+  {
+    const auto path = directory / filename;
+    std::ofstream(path.string()) << content;
+    return path;
+  }
+};
+
+TEST_F(XmlDocumentCache, sameContentSharesDocument)
+{
+  const auto a = write("a.xosc", "<SameContentSharesDocument/>");
+  const auto b = write("b.xosc", "<SameContentSharesDocument/>");
+  const auto document = loadXmlDocument(a);
+  EXPECT_TRUE(document->child("SameContentSharesDocument"));
+  EXPECT_EQ(loadXmlDocument(a), document);
+  EXPECT_EQ(loadXmlDocument(b), document);
+}
+
+TEST_F(XmlDocumentCache, changedContentUnderSamePathParsedAgain)
+{
+  const auto path = write("scenario.xosc", "<ChangedContentBefore/>");
+  const auto before = loadXmlDocument(path);
+  write("scenario.xosc", "<ChangedContentAfter/>");
+  const auto after = loadXmlDocument(path);
+  EXPECT_NE(after, before);
+  EXPECT_TRUE(before->child("ChangedContentBefore"));
+  EXPECT_TRUE(after->child("ChangedContentAfter"));
+}
+
+TEST_F(XmlDocumentCache, leastRecentlyUsedDocumentEvicted)
+{
+  constexpr std::size_t capacity = 64;
+  const auto kept = write("kept.xosc", "<Kept/>");
+  const auto evicted = write("evicted.xosc", "<Evicted/>");
+  const auto kept_document = loadXmlDocument(kept);
+  const auto evicted_document = loadXmlDocument(evicted);
+  for (std::size_t i = 0; i < capacity - 1; ++i) {
+    loadXmlDocument(kept);
+    loadXmlDocument(write("filler.xosc", "<Filler index=\"" + std::to_string(i) + "\"/>"));
+  }
+  EXPECT_EQ(loadXmlDocument(kept), kept_document);
+  EXPECT_NE(loadXmlDocument(evicted), evicted_document);
+}
+
+TEST_F(XmlDocumentCache, convertedDocumentCached)
+{
+  const auto yaml = write("catalog.yaml", "ConvertedDocumentCached: {}");
+  const auto xml = write("catalog.xosc", "<ConvertedDocumentCached/>");
+  std::size_t conversion_count = 0;
+  const auto convert = [&](const auto &) {
+    ++conversion_count;
+    return xml;
+  };
+  const auto document = loadXmlDocument(yaml, convert);
+  EXPECT_TRUE(document->child("ConvertedDocumentCached"));
+  EXPECT_EQ(loadXmlDocument(yaml, convert), document);
+  EXPECT_EQ(conversion_count, 1u);
+}
+
+TEST_F(XmlDocumentCache, unreadableFileConverted)
+{
+  const auto xml = write("catalog.xosc", "<UnreadableFileConverted/>");
+  const auto document =
+    loadXmlDocumentLeniently(directory / "missing.yaml", [&](const auto &) { return xml; });
+  EXPECT_TRUE(document->child("UnreadableFileConverted"));
+}
+
+TEST_F(XmlDocumentCache, malformedDocument)
+{
+  const auto path = write("malformed.xosc", "MalformedDocument: {}");
+  EXPECT_THROW(loadXmlDocument(path), openscenario_interpreter::SyntaxError);
+  EXPECT_NO_THROW(loadXmlDocumentLeniently(path));
+  EXPECT_THROW(loadXmlDocument(directory / "missing.xosc"), openscenario_interpreter::SyntaxError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -19,7 +19,9 @@
 #include <rclcpp/rclcpp.hpp>
 #endif
 
+#include <cstdint>
 #include <mutex>
+#include <nlohmann/json.hpp>
 #include <openscenario_interpreter_msgs/msg/context.hpp>
 #include <openscenario_visualization/context_panel_plugin.hpp>
 #include <rviz_common/panel.hpp>
@@ -65,7 +67,8 @@ private:
   void startSubscription();
   void contextCallback(const openscenario_interpreter_msgs::msg::Context::ConstSharedPtr msg);
   void spin();
-  std::string context_;
+  nlohmann::json context_;
+  std::uint64_t context_revision_ = 0;
   double simulation_time_;
   std::vector<std::string> item_vec_;
   std::vector<std::vector<std::string>> condition_group_vec_;
@@ -54,9 +54,25 @@ void ContextPanel::onDisable()
 void ContextPanel::contextCallback(
   const openscenario_interpreter_msgs::msg::Context::ConstSharedPtr msg)
 {
-  context_ = msg->data;
+  // NOTE: A patch is only valid against the context of the preceding revision. If a message was
+  // dropped or the patch cannot be applied, discard the context and wait for the next snapshot.
+  try {
+    if (msg->type == openscenario_interpreter_msgs::msg::Context::PATCH) {
+      if (context_.is_null() or msg->revision != context_revision_ + 1) {
+        context_ = nullptr;
+        return;
+      }
+      context_ = context_.patch(json::parse(msg->data));
+    } else {
+      context_ = json::parse(msg->data);
+    }
+    context_revision_ = msg->revision;
+  } catch (const json::exception &) {
+    context_ = nullptr;
+    return;
+  }
   simulation_time_ = msg->time;
-  json j_ = json::parse(context_);
+  json j_ = context_;
   condition_group_vec_.clear();
   item_vec_.clear();
   auto story_json = j_["OpenSCENARIO"]["Storyboard"]["Story"];
@@ -17,6 +17,7 @@
 
 #include <behaviortree_cpp_v3/action_node.h>
 
+#include <behavior_tree_plugin/perception_context.hpp>
 #include <boost/algorithm/clamp.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <memory>
@@ -50,6 +51,9 @@ public:
   boost::optional<double> getDistanceToStopLine(
     const std::vector<std::int64_t> & route_lanelets,
     const std::vector<geometry_msgs::msg::Point> & waypoints);
+  boost::optional<double> getDistanceToStopLine(
+    const std::vector<std::int64_t> & route_lanelets,
+    const math::geometry::CatmullRomSplineInterface & spline);
   boost::optional<double> getDistanceToTrafficLightStopLine(
     const std::vector<std::int64_t> & route_lanelets,
     const math::geometry::CatmullRomSplineInterface & spline);
@@ -81,6 +85,7 @@ public:
       BT::OutputPort<traffic_simulator::behavior::Request>("request"),
       BT::InputPort<std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus>>(
         "other_entity_status"),
+      BT::InputPort<std::shared_ptr<PerceptionContext>>("perception_context"),
       BT::InputPort<std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>(
         "entity_type_list"),
       BT::InputPort<std::vector<std::int64_t>>("route_lanelets"),
@@ -98,7 +103,7 @@ public:
   double step_time;
   boost::optional<double> target_speed;
   traffic_simulator_msgs::msg::EntityStatus updated_status;
-  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> other_entity_status;
+  std::shared_ptr<PerceptionContext> perception_context;
   std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> entity_type_list;
   std::vector<std::int64_t> route_lanelets;
   traffic_simulator_msgs::msg::EntityStatus getEntityStatus(const std::string target_name) const;
@@ -0,0 +1,110 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_TREE_PLUGIN__PERCEPTION_CONTEXT_HPP_
+#define BEHAVIOR_TREE_PLUGIN__PERCEPTION_CONTEXT_HPP_
+
+#include <algorithm>
+#include <boost/any.hpp>
+#include <cstdint>
+#include <geometry/spline/catmull_rom_spline_interface.hpp>
+#include <geometry/spline/catmull_rom_subspline.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <traffic_simulator/behavior/behavior_plugin_base.hpp>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace entity_behavior
+{
+/**
+ * @brief What one entity perceives during one frame, shared by every node of its behavior tree.
+ * The behavior tree builds a new context before ticking, so each query below is evaluated at
+ * most once per entity per frame no matter how many nodes ask for it.
+ */
+class PerceptionContext
+{
+public:
+  using EntityStatusDict = BehaviorPluginBase::EntityStatusDict;
+
+  explicit PerceptionContext(EntityStatusDict other_entity_status)
+  : other_entity_status_(std::move(other_entity_status))
+  {
+  }
+
+  const EntityStatusDict & getOtherEntityStatus() const { return other_entity_status_; }
+
+  /**
+   * @brief Returns the cached result of a query which does not depend on a trajectory,
+   * computing it on the first request.
+   */
+  template <typename Result, typename Function>
+  Result memoize(
+    const std::string & query, const std::vector<std::int64_t> & route_lanelets,
+    Function && compute)
+  {
+    return memoize<Result>(Key(query, route_lanelets, nullptr, 0, 0), compute);
+  }
+
+  /**
+   * @brief Returns the cached result of a query along the trajectory, computing it on the first
+   * request.
+   * @note A trajectory is identified by the reference spline it is cut out of and the s range it
+   * covers. The context keeps the reference spline alive so that its address cannot be reused by
+   * another spline during the frame. Trajectories which are not subsplines are not cached.
+   */
+  template <typename Result, typename Function>
+  Result memoize(
+    const std::string & query, const std::vector<std::int64_t> & route_lanelets,
+    const math::geometry::CatmullRomSplineInterface & trajectory, Function && compute)
+  {
+    const auto subspline = dynamic_cast<const math::geometry::CatmullRomSubspline *>(&trajectory);
+    if (not subspline or not subspline->getSpline()) {
+      return compute();
+    }
+    const auto & spline = subspline->getSpline();
+    if (std::find(splines_.begin(), splines_.end(), spline) == splines_.end()) {
+      splines_.push_back(spline);
+    }
+    return memoize<Result>(
+      Key(query, route_lanelets, spline.get(), subspline->getStartS(), subspline->getEndS()),
+      compute);
+  }
+
+private:
+  using Key = std::tuple<
+    std::string, std::vector<std::int64_t>, const math::geometry::CatmullRomSpline *, double,
+    double>;
+
+  template <typename Result, typename Function>
+  Result memoize(Key && key, Function && compute)
+  {
+    if (const auto iter = results_.find(key); iter != results_.end()) {
+      return boost::any_cast<const Result &>(iter->second);
+    }
+    const auto iter = results_.emplace(std::move(key), Result(compute())).first;
+    return boost::any_cast<const Result &>(iter->second);
+  }
+
+  const EntityStatusDict other_entity_status_;
+
+  std::vector<std::shared_ptr<math::geometry::CatmullRomSpline>> splines_;
+
+  std::map<Key, boost::any> results_;
+};
+}  // namespace entity_behavior
+
+#endif  // BEHAVIOR_TREE_PLUGIN__PERCEPTION_CONTEXT_HPP_
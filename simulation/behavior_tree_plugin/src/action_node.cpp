@@ -61,9 +61,18 @@ void ActionNode::getBlackBoardValues()
     target_speed = boost::none;
   }
 
-  if (!getInput<std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus>>(
-        "other_entity_status", other_entity_status)) {
-    THROW_SIMULATION_ERROR("failed to get input other_entity_status in ActionNode");
+  if (!getInput<std::shared_ptr<PerceptionContext>>("perception_context", perception_context)) {
+    /**
+     * @note Trees written before perception_context was introduced only bind other_entity_status.
+     * They still work, but every node builds its own context and nothing is shared between nodes.
+     */
+    PerceptionContext::EntityStatusDict other_entity_status;
+    if (!getInput<PerceptionContext::EntityStatusDict>(
+          "other_entity_status", other_entity_status)) {
+      THROW_SIMULATION_ERROR(
+        "failed to get input perception_context or other_entity_status in ActionNode");
+    }
+    perception_context = std::make_shared<PerceptionContext>(std::move(other_entity_status));
   }
   if (!getInput<std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>(
         "entity_type_list", entity_type_list)) {
@@ -92,7 +101,7 @@ std::vector<traffic_simulator_msgs::msg::EntityStatus> ActionNode::getOtherEntit
   std::int64_t lanelet_id)
 {
   std::vector<traffic_simulator_msgs::msg::EntityStatus> ret;
-  for (const auto & status : other_entity_status) {
+  for (const auto & status : perception_context->getOtherEntityStatus()) {
     if (status.second.lanelet_pose_valid) {
       if (status.second.lanelet_pose.lanelet_id == lanelet_id) {
         ret.emplace_back(status.second);
@@ -105,41 +114,48 @@ std::vector<traffic_simulator_msgs::msg::EntityStatus> ActionNode::getOtherEntit
 boost::optional<double> ActionNode::getYieldStopDistance(
   const std::vector<std::int64_t> & following_lanelets)
 {
-  std::set<double> distances;
-  for (const auto & lanelet : following_lanelets) {
-    const auto right_of_way_ids = hdmap_utils->getRightOfWayLaneletIds(lanelet);
-    for (const auto right_of_way_id : right_of_way_ids) {
-      const auto other_status = getOtherEntityStatus(right_of_way_id);
-      if (other_status.size() != 0) {
-        auto distance = hdmap_utils->getLongitudinalDistance(
-          entity_status.lanelet_pose.lanelet_id, entity_status.lanelet_pose.s, lanelet, 0);
-        if (distance) {
-          distances.insert(distance.get());
+  return perception_context->memoize<boost::optional<double>>(
+    "yield_stop_distance", following_lanelets, [&]() -> boost::optional<double> {
+      std::set<double> distances;
+      for (const auto & lanelet : following_lanelets) {
+        const auto right_of_way_ids = hdmap_utils->getRightOfWayLaneletIds(lanelet);
+        for (const auto right_of_way_id : right_of_way_ids) {
+          const auto other_status = getOtherEntityStatus(right_of_way_id);
+          if (other_status.size() != 0) {
+            auto distance = hdmap_utils->getLongitudinalDistance(
+              entity_status.lanelet_pose.lanelet_id, entity_status.lanelet_pose.s, lanelet, 0);
+            if (distance) {
+              distances.insert(distance.get());
+            }
+          }
+        }
+        if (distances.size() != 0) {
+          return *distances.begin();
         }
       }
-    }
-    if (distances.size() != 0) {
-      return *distances.begin();
-    }
-  }
-  return boost::none;
+      return boost::none;
+    });
 }
 
 std::vector<traffic_simulator_msgs::msg::EntityStatus> ActionNode::getRightOfWayEntities(
   const std::vector<std::int64_t> & following_lanelets)
 {
-  std::vector<traffic_simulator_msgs::msg::EntityStatus> ret;
-  const auto lanelet_ids_list = hdmap_utils->getRightOfWayLaneletIds(following_lanelets);
-  for (const auto & status : other_entity_status) {
-    for (const auto & following_lanelet : following_lanelets) {
-      for (const std::int64_t & lanelet_id : lanelet_ids_list.at(following_lanelet)) {
-        if (lanelet_id == status.second.lanelet_pose.lanelet_id) {
-          ret.emplace_back(status.second);
+  using Result = std::vector<traffic_simulator_msgs::msg::EntityStatus>;
+  return perception_context->memoize<Result>(
+    "right_of_way_entities", following_lanelets, [&]() {
+      Result ret;
+      const auto lanelet_ids_list = hdmap_utils->getRightOfWayLaneletIds(following_lanelets);
+      for (const auto & status : perception_context->getOtherEntityStatus()) {
+        for (const auto & following_lanelet : following_lanelets) {
+          for (const std::int64_t & lanelet_id : lanelet_ids_list.at(following_lanelet)) {
+            if (lanelet_id == status.second.lanelet_pose.lanelet_id) {
+              ret.emplace_back(status.second);
+            }
+          }
         }
       }
-    }
-  }
-  return ret;
+      return ret;
+    });
 }
 
 std::vector<traffic_simulator_msgs::msg::EntityStatus> ActionNode::getRightOfWayEntities()
@@ -150,7 +166,7 @@ std::vector<traffic_simulator_msgs::msg::EntityStatus> ActionNode::getRightOfWay
   if (lanelet_ids.empty()) {
     return ret;
   }
-  for (const auto & status : other_entity_status) {
+  for (const auto & status : perception_context->getOtherEntityStatus()) {
     for (const std::int64_t & lanelet_id : lanelet_ids) {
       if (lanelet_id == status.second.lanelet_pose.lanelet_id) {
         ret.emplace_back(status.second);
@@ -164,28 +180,32 @@ boost::optional<double> ActionNode::getDistanceToTrafficLightStopLine(
   const std::vector<std::int64_t> & route_lanelets,
   const math::geometry::CatmullRomSplineInterface & spline)
 {
-  const auto traffic_light_ids = hdmap_utils->getTrafficLightIdsOnPath(route_lanelets);
-  if (traffic_light_ids.empty()) {
-    return boost::none;
-  }
-  std::set<double> collision_points = {};
-  for (const auto id : traffic_light_ids) {
-    using Color = traffic_simulator::TrafficLight::Color;
-    using Status = traffic_simulator::TrafficLight::Status;
-    using Shape = traffic_simulator::TrafficLight::Shape;
-    if (auto && traffic_light = traffic_light_manager->getTrafficLight(id);
-        traffic_light.contains(Color::red, Status::solid_on, Shape::circle) or
-        traffic_light.contains(Color::yellow, Status::solid_on, Shape::circle)) {
-      const auto collision_point = hdmap_utils->getDistanceToTrafficLightStopLine(spline, id);
-      if (collision_point) {
-        collision_points.insert(collision_point.get());
+  return perception_context->memoize<boost::optional<double>>(
+    "distance_to_traffic_light_stop_line", route_lanelets, spline,
+    [&]() -> boost::optional<double> {
+      const auto traffic_light_ids = hdmap_utils->getTrafficLightIdsOnPath(route_lanelets);
+      if (traffic_light_ids.empty()) {
+        return boost::none;
       }
-    }
-  }
-  if (collision_points.empty()) {
-    return boost::none;
-  }
-  return *collision_points.begin();
+      std::set<double> collision_points = {};
+      for (const auto id : traffic_light_ids) {
+        using Color = traffic_simulator::TrafficLight::Color;
+        using Status = traffic_simulator::TrafficLight::Status;
+        using Shape = traffic_simulator::TrafficLight::Shape;
+        if (auto && traffic_light = traffic_light_manager->getTrafficLight(id);
+            traffic_light.contains(Color::red, Status::solid_on, Shape::circle) or
+            traffic_light.contains(Color::yellow, Status::solid_on, Shape::circle)) {
+          const auto collision_point = hdmap_utils->getDistanceToTrafficLightStopLine(spline, id);
+          if (collision_point) {
+            collision_points.insert(collision_point.get());
+          }
+        }
+      }
+      if (collision_points.empty()) {
+        return boost::none;
+      }
+      return *collision_points.begin();
+    });
 }
 
 boost::optional<double> ActionNode::getDistanceToStopLine(
@@ -195,46 +215,61 @@ boost::optional<double> ActionNode::getDistanceToStopLine(
   return hdmap_utils->getDistanceToStopLine(route_lanelets, waypoints);
 }
 
+boost::optional<double> ActionNode::getDistanceToStopLine(
+  const std::vector<std::int64_t> & route_lanelets,
+  const math::geometry::CatmullRomSplineInterface & spline)
+{
+  return perception_context->memoize<boost::optional<double>>(
+    "distance_to_stop_line", route_lanelets, spline,
+    [&]() { return hdmap_utils->getDistanceToStopLine(route_lanelets, spline); });
+}
+
 boost::optional<double> ActionNode::getDistanceToFrontEntity(
   const math::geometry::CatmullRomSplineInterface & spline)
 {
-  auto name = getFrontEntityName(spline);
-  if (!name) {
-    return boost::none;
-  }
-  return getDistanceToTargetEntityPolygon(spline, name.get());
+  return perception_context->memoize<boost::optional<double>>(
+    "distance_to_front_entity", {}, spline, [&]() -> boost::optional<double> {
+      auto name = getFrontEntityName(spline);
+      if (!name) {
+        return boost::none;
+      }
+      return getDistanceToTargetEntityPolygon(spline, name.get());
+    });
 }
 
 boost::optional<std::string> ActionNode::getFrontEntityName(
   const math::geometry::CatmullRomSplineInterface & spline)
 {
-  std::vector<double> distances;
-  std::vector<std::string> entities;
-  for (const auto & each : other_entity_status) {
-    const auto distance = getDistanceToTargetEntityPolygon(spline, each.first);
-    const auto quat = quaternion_operation::getRotation(
-      entity_status.pose.orientation, other_entity_status.at(each.first).pose.orientation);
-    /**
-     * @note hard-coded parameter, if the Yaw value of RPY is in ~1.5708 -> 1.5708, entity is a candidate of front entity.
-     */
-    if (
-      std::fabs(quaternion_operation::convertQuaternionToEulerAngle(quat).z) <=
-      boost::math::constants::half_pi<double>()) {
-      if (distance && distance.get() < 40) {
-        entities.emplace_back(each.first);
-        distances.emplace_back(distance.get());
+  return perception_context->memoize<boost::optional<std::string>>(
+    "front_entity_name", {}, spline, [&]() -> boost::optional<std::string> {
+      std::vector<double> distances;
+      std::vector<std::string> entities;
+      for (const auto & each : perception_context->getOtherEntityStatus()) {
+        const auto distance = getDistanceToTargetEntityPolygon(spline, each.first);
+        const auto quat = quaternion_operation::getRotation(
+          entity_status.pose.orientation, each.second.pose.orientation);
+        /**
+         * @note hard-coded parameter, if the Yaw value of RPY is in ~1.5708 -> 1.5708, entity is a candidate of front entity.
+         */
+        if (
+          std::fabs(quaternion_operation::convertQuaternionToEulerAngle(quat).z) <=
+          boost::math::constants::half_pi<double>()) {
+          if (distance && distance.get() < 40) {
+            entities.emplace_back(each.first);
+            distances.emplace_back(distance.get());
+          }
+        }
       }
-    }
-  }
-  if (entities.size() != distances.size()) {
-    THROW_SIMULATION_ERROR("size of entities and distances vector does not match.");
-  }
-  if (distances.empty()) {
-    return boost::none;
-  }
-  std::vector<double>::iterator iter = std::min_element(distances.begin(), distances.end());
-  size_t index = std::distance(distances.begin(), iter);
-  return entities[index];
+      if (entities.size() != distances.size()) {
+        THROW_SIMULATION_ERROR("size of entities and distances vector does not match.");
+      }
+      if (distances.empty()) {
+        return boost::none;
+      }
+      std::vector<double>::iterator iter = std::min_element(distances.begin(), distances.end());
+      size_t index = std::distance(distances.begin(), iter);
+      return entities[index];
+    });
 }
 
 boost::optional<double> ActionNode::getDistanceToTargetEntityOnCrosswalk(
@@ -251,7 +286,8 @@ boost::optional<double> ActionNode::getDistanceToTargetEntityOnCrosswalk(
 traffic_simulator_msgs::msg::EntityStatus ActionNode::getEntityStatus(
   const std::string target_name) const
 {
-  if (other_entity_status.find(target_name) != other_entity_status.end()) {
+  if (const auto & other_entity_status = perception_context->getOtherEntityStatus();
+      other_entity_status.find(target_name) != other_entity_status.end()) {
     return other_entity_status.at(target_name);
   }
   THROW_SIMULATION_ERROR("other entity : ", target_name, " does not exist.");
@@ -290,25 +326,28 @@ boost::optional<double> ActionNode::getDistanceToConflictingEntity(
   const std::vector<std::int64_t> & route_lanelets,
   const math::geometry::CatmullRomSplineInterface & spline)
 {
-  auto crosswalk_entity_status = getConflictingEntityStatusOnCrossWalk(route_lanelets);
-  auto lane_entity_status = getConflictingEntityStatusOnLane(route_lanelets);
-  std::set<double> distances;
-  for (const auto & status : crosswalk_entity_status) {
-    const auto s = getDistanceToTargetEntityOnCrosswalk(spline, status);
-    if (s) {
-      distances.insert(s.get());
-    }
-  }
-  for (const auto & status : lane_entity_status) {
-    const auto s = getDistanceToTargetEntityPolygon(spline, status, 0.0, 0.0, 0.0, 1.0);
-    if (s) {
-      distances.insert(s.get());
-    }
-  }
-  if (distances.empty()) {
-    return boost::none;
-  }
-  return *distances.begin();
+  return perception_context->memoize<boost::optional<double>>(
+    "distance_to_conflicting_entity", route_lanelets, spline, [&]() -> boost::optional<double> {
+      auto crosswalk_entity_status = getConflictingEntityStatusOnCrossWalk(route_lanelets);
+      auto lane_entity_status = getConflictingEntityStatusOnLane(route_lanelets);
+      std::set<double> distances;
+      for (const auto & status : crosswalk_entity_status) {
+        const auto s = getDistanceToTargetEntityOnCrosswalk(spline, status);
+        if (s) {
+          distances.insert(s.get());
+        }
+      }
+      for (const auto & status : lane_entity_status) {
+        const auto s = getDistanceToTargetEntityPolygon(spline, status, 0.0, 0.0, 0.0, 1.0);
+        if (s) {
+          distances.insert(s.get());
+        }
+      }
+      if (distances.empty()) {
+        return boost::none;
+      }
+      return *distances.begin();
+    });
 }
 
 std::vector<traffic_simulator_msgs::msg::EntityStatus>
@@ -317,7 +356,7 @@ ActionNode::getConflictingEntityStatusOnCrossWalk(
 {
   std::vector<traffic_simulator_msgs::msg::EntityStatus> conflicting_entity_status;
   auto conflicting_crosswalks = hdmap_utils->getConflictingCrosswalkIds(route_lanelets);
-  for (const auto & status : other_entity_status) {
+  for (const auto & status : perception_context->getOtherEntityStatus()) {
     if (
       std::count(
         conflicting_crosswalks.begin(), conflicting_crosswalks.end(),
@@ -333,7 +372,7 @@ std::vector<traffic_simulator_msgs::msg::EntityStatus> ActionNode::getConflictin
 {
   std::vector<traffic_simulator_msgs::msg::EntityStatus> conflicting_entity_status;
   auto conflicting_lanes = hdmap_utils->getConflictingLaneIds(route_lanelets);
-  for (const auto & status : other_entity_status) {
+  for (const auto & status : perception_context->getOtherEntityStatus()) {
     if (
       std::count(
         conflicting_lanes.begin(), conflicting_lanes.end(),
@@ -348,7 +387,7 @@ bool ActionNode::foundConflictingEntity(const std::vector<std::int64_t> & follow
 {
   auto conflicting_crosswalks = hdmap_utils->getConflictingCrosswalkIds(following_lanelets);
   auto conflicting_lanes = hdmap_utils->getConflictingLaneIds(following_lanelets);
-  for (const auto & status : other_entity_status) {
+  for (const auto & status : perception_context->getOtherEntityStatus()) {
     if (
       std::count(
         conflicting_crosswalks.begin(), conflicting_crosswalks.end(),
@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <ament_index_cpp/get_package_share_directory.hpp>
 #include <behavior_tree_plugin/pedestrian/behavior_tree.hpp>
+#include <behavior_tree_plugin/perception_context.hpp>
 #include <iostream>
 #include <memory>
 #include <string>
@@ -44,6 +45,8 @@ const std::string & PedestrianBehaviorTree::getCurrentAction() const
 
 void PedestrianBehaviorTree::update(double current_time, double step_time)
 {
+  tree_.rootBlackboard()->set<std::shared_ptr<PerceptionContext>>(
+    "perception_context", std::make_shared<PerceptionContext>(getOtherEntityStatus()));
   tickOnce(current_time, step_time);
   while (getCurrentAction() == "root") {
     tickOnce(current_time, step_time);
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <ament_index_cpp/get_package_share_directory.hpp>
+#include <behavior_tree_plugin/perception_context.hpp>
 #include <behavior_tree_plugin/vehicle/behavior_tree.hpp>
 #include <behavior_tree_plugin/vehicle/follow_lane_sequence/follow_front_entity_action.hpp>
 #include <behavior_tree_plugin/vehicle/follow_lane_sequence/follow_lane_action.hpp>
@@ -24,6 +25,7 @@
 #include <behavior_tree_plugin/vehicle/follow_lane_sequence/yield_action.hpp>
 #include <behavior_tree_plugin/vehicle/lane_change_action.hpp>
 #include <iostream>
+#include <memory>
 #include <string>
 #include <traffic_simulator_msgs/msg/driver_model.hpp>
 #include <utility>
@@ -68,6 +70,8 @@ const std::string & VehicleBehaviorTree::getCurrentAction() const
 
 void VehicleBehaviorTree::update(double current_time, double step_time)
 {
+  tree_.rootBlackboard()->set<std::shared_ptr<PerceptionContext>>(
+    "perception_context", std::make_shared<PerceptionContext>(getOtherEntityStatus()));
   tickOnce(current_time, step_time);
   while (getCurrentAction() == "root") {
     tickOnce(current_time, step_time);
@@ -48,6 +48,11 @@ protected:
 public:
   virtual ~DetectionSensorBase() = default;
 
+  auto getConfiguration() const -> const simulation_api_schema::DetectionSensorConfiguration &
+  {
+    return configuration_;
+  }
+
   virtual void update(
     const double, const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
     const std::vector<std::string> & lidar_detected_entity) = 0;
@@ -20,7 +20,9 @@
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
+#include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace simple_sensor_simulator
@@ -43,6 +45,11 @@ protected:
 public:
   virtual ~LidarSensorBase() = default;
 
+  auto getConfiguration() const -> const simulation_api_schema::LidarConfiguration &
+  {
+    return configuration_;
+  }
+
   virtual auto update(
     const double, const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &)
     -> void = 0;
@@ -55,14 +62,21 @@ class LidarSensor : public LidarSensorBase
 {
   const typename rclcpp::Publisher<T>::SharedPtr publisher_ptr_;
 
-  auto raycast(const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &)
-    -> T;
+  Raycaster raycaster_;
+
+  T message_;
+
+  auto raycast(
+    const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &, T &) -> void;
 
 public:
   explicit LidarSensor(
     const double current_time, const simulation_api_schema::LidarConfiguration & configuration,
-    const typename rclcpp::Publisher<T>::SharedPtr & publisher_ptr)
-  : LidarSensorBase(current_time, configuration), publisher_ptr_(publisher_ptr)
+    const typename rclcpp::Publisher<T>::SharedPtr & publisher_ptr,
+    const std::shared_ptr<ThreadPool> & thread_pool = std::make_shared<ThreadPool>())
+  : LidarSensorBase(current_time, configuration),
+    publisher_ptr_(publisher_ptr),
+    raycaster_(thread_pool)
   {
   }
 
@@ -72,7 +86,14 @@ public:
   {
     if (current_time - last_update_stamp_ - configuration_.scan_duration() >= -0.002) {
       last_update_stamp_ = current_time;
-      publisher_ptr_->publish(raycast(status, stamp));
+      if (publisher_ptr_->can_loan_messages()) {
+        auto message = publisher_ptr_->borrow_loaned_message();
+        raycast(status, stamp, message.get());
+        publisher_ptr_->publish(std::move(message));
+      } else {
+        raycast(status, stamp, message_);
+        publisher_ptr_->publish(message_);
+      }
     } else {
       detected_objects_ = {};
     }
@@ -81,8 +102,8 @@ public:
 
 template <>
 auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
-  const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &)
-  -> sensor_msgs::msg::PointCloud2;
+  const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
+  sensor_msgs::msg::PointCloud2 &) -> void;
 }  // namespace simple_sensor_simulator
 
 #endif  // SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__LIDAR__LIDAR_SENSOR_HPP_
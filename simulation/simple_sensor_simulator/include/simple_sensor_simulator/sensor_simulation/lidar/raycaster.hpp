@@ -18,6 +18,7 @@
 #include <embree3/rtcore.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <Eigen/Core>
 #include <geometry_msgs/msg/pose.hpp>
 #include <geometry_msgs/msg/vector3.hpp>
 #include <memory>
@@ -25,6 +26,7 @@
 #include <sensor_msgs/msg/point_cloud2.hpp>
 #include <simple_sensor_simulator/sensor_simulation/primitives/box.hpp>
 #include <simple_sensor_simulator/sensor_simulation/primitives/primitive.hpp>
+#include <simple_sensor_simulator/thread_pool.hpp>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -37,6 +39,9 @@ class Raycaster
 public:
   Raycaster();
   explicit Raycaster(std::string embree_config);
+  explicit Raycaster(const std::shared_ptr<ThreadPool> & thread_pool);
+  Raycaster(const Raycaster &) = delete;
+  Raycaster & operator=(const Raycaster &) = delete;
   ~Raycaster();
   template <typename T, typename... Ts>
   void addPrimitive(std::string name, Ts &&... xs)
@@ -45,25 +50,52 @@ public:
       throw std::runtime_error("primitive " + name + " already exist.");
     }
     auto primitive_ptr = std::make_unique<T>(std::forward<Ts>(xs)...);
+    attachPrimitive(name, *primitive_ptr);
     primitive_ptrs_.emplace(name, std::move(primitive_ptr));
   }
+  bool hasPrimitive(const std::string & name) const;
+  void setPrimitivePose(const std::string & name, const geometry_msgs::msg::Pose & pose);
+  void removePrimitive(const std::string & name);
+  std::vector<std::string> getPrimitiveNames() const;
   const sensor_msgs::msg::PointCloud2 raycast(
     std::string frame_id, const rclcpp::Time & stamp, geometry_msgs::msg::Pose origin,
     double horizontal_resolution, std::vector<double> vertical_angles,
     double horizontal_angle_start = 0, double horizontal_angle_end = 2 * M_PI,
     double max_distance = 100, double min_distance = 0);
+  void raycast(
+    sensor_msgs::msg::PointCloud2 & pointcloud_msg, std::string frame_id,
+    const rclcpp::Time & stamp, geometry_msgs::msg::Pose origin, double horizontal_resolution,
+    std::vector<double> vertical_angles, double horizontal_angle_start = 0,
+    double horizontal_angle_end = 2 * M_PI, double max_distance = 100, double min_distance = 0);
   const std::vector<std::string> & getDetectedObject() const;
 
 private:
+  struct Instance
+  {
+    RTCScene scene;
+    unsigned int geometry_id;
+  };
+  void attachPrimitive(const std::string & name, const primitives::Primitive & primitive);
   std::unordered_map<std::string, std::unique_ptr<primitives::Primitive>> primitive_ptrs_;
+  std::unordered_map<std::string, Instance> instances_;
   RTCDevice device_;
   RTCScene scene_;
   std::random_device seed_gen_;
   std::default_random_engine engine_;
-  const sensor_msgs::msg::PointCloud2 raycast(
-    std::string frame_id, const rclcpp::Time & stamp, geometry_msgs::msg::Pose origin,
-    std::vector<geometry_msgs::msg::Quaternion> directions, double max_distance = 100,
-    double min_distance = 0);
+  std::shared_ptr<ThreadPool> thread_pool_;
+  void setDirections(
+    double horizontal_resolution, const std::vector<double> & vertical_angles,
+    double horizontal_angle_start, double horizontal_angle_end);
+  void castRays(const geometry_msgs::msg::Pose & origin, double max_distance, double min_distance);
+  void writePointCloud(sensor_msgs::msg::PointCloud2 & pointcloud_msg);
+  double horizontal_resolution_;
+  std::vector<double> vertical_angles_;
+  double horizontal_angle_start_;
+  double horizontal_angle_end_;
+  Eigen::Matrix3Xf directions_;
+  std::vector<float> distances_;
+  std::vector<unsigned int> hit_ids_;
+  std::vector<bool> detected_ids_;
   std::vector<std::string> detected_objects_;
   std::unordered_map<unsigned int, std::string> geometry_ids_;
 };
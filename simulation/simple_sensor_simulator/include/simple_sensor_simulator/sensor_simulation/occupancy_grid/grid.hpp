@@ -15,17 +15,19 @@
 #ifndef SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__OCCUPANCY_GRID__GRID_HPP_
 #define SIMPLE_SENSOR_SIMULATOR__SENSOR_SIMULATION__OCCUPANCY_GRID__GRID_HPP_
 
-#include <boost/optional.hpp>
-#include <geometry/polygon/line_segment.hpp>
+#include <cstdint>
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
-#include <geometry_msgs/msg/vector3.hpp>
-#include <simple_sensor_simulator/sensor_simulation/occupancy_grid/grid_cell.hpp>
-#include <simple_sensor_simulator/sensor_simulation/primitives/box.hpp>
+#include <memory>
+#include <simple_sensor_simulator/sensor_simulation/primitives/primitive.hpp>
 #include <vector>
 
 namespace simple_sensor_simulator
 {
+/**
+ * @brief Occupancy grid buffer. The buffer is allocated once and cleared by updateOrigin, so one
+ * grid can be reused for every frame.
+ */
 class Grid
 {
 public:
@@ -38,68 +40,17 @@ public:
   const int8_t occupied_cost;
   const int8_t invisible_cost;
   void addPrimitive(const std::unique_ptr<primitives::Primitive> & primitive);
-  std::vector<int8_t> getData();
+  const std::vector<int8_t> & getData() const;
   void updateOrigin(const geometry_msgs::msg::Pose & origin);
 
 private:
   geometry_msgs::msg::Pose origin_;
-  std::vector<GridCell> grid_cells_;
-  bool fillByIndex(size_t index, int8_t data);
-  void fillByRow(size_t row, int8_t data);
-  void fillByCol(size_t col, int8_t data);
-  bool fillByRowCol(size_t row, size_t col, int8_t data);
-  std::vector<std::pair<size_t, size_t>> fillByIntersection(
-    const math::geometry::LineSegment & line_segment, int8_t data);
-  std::vector<std::pair<size_t, size_t>> fillByIntersection(
-    const std::vector<math::geometry::LineSegment> & line_segments, int8_t data);
-  std::vector<std::pair<size_t, size_t>> fillInside(
-    const std::vector<std::pair<size_t, size_t>> & row_and_cols, int8_t data);
-  size_t getIndex(size_t row, size_t col) const;
-  size_t getNextRowIndex(size_t row, size_t col) const;
-  size_t getNextColIndex(size_t row, size_t col) const;
-  size_t getPreviousRowIndex(size_t row, size_t col) const;
-  size_t getPreviousColIndex(size_t row, size_t col) const;
-  std::vector<std::pair<size_t, size_t>> filterByRow(
-    const std::vector<std::pair<size_t, size_t>> & row_and_cols, size_t row) const;
-  std::vector<std::pair<size_t, size_t>> filterByCol(
-    const std::vector<std::pair<size_t, size_t>> & row_and_cols, size_t col) const;
-  std::vector<math::geometry::LineSegment> filterByIntersection(
-    const std::vector<math::geometry::LineSegment> & source_lines,
-    const std::vector<math::geometry::LineSegment> & fillter_lines) const;
-  std::vector<size_t> getRows(const std::vector<std::pair<size_t, size_t>> & row_and_cols) const;
-  std::vector<size_t> getCols(const std::vector<std::pair<size_t, size_t>> & row_and_cols) const;
-  bool indexExist(size_t index) const;
-  geometry_msgs::msg::Point transformToWorld(const geometry_msgs::msg::Point & grid_point) const;
+  std::vector<int8_t> values_;
+  void fillPolygon(const std::vector<geometry_msgs::msg::Point> & polygon, int8_t data);
+  std::vector<geometry_msgs::msg::Point> getInvisibleArea(
+    const std::vector<geometry_msgs::msg::Point> & polygon) const;
   geometry_msgs::msg::Point transformToGrid(const geometry_msgs::msg::Point & world_point) const;
-  math::geometry::LineSegment transformToGrid(const math::geometry::LineSegment & line) const;
   geometry_msgs::msg::Point transformToPixel(const geometry_msgs::msg::Point & grid_point) const;
-  math::geometry::LineSegment transformToPixel(const math::geometry::LineSegment & line) const;
-  math::geometry::LineSegment getInvisibleRay(
-    const geometry_msgs::msg::Point & point_on_polygon) const;
-  std::vector<math::geometry::LineSegment> getRayToGridCorner() const;
-  std::vector<math::geometry::LineSegment> getInvisibleRay(
-    const std::vector<geometry_msgs::msg::Point> & points) const;
-  double getDiagonalLength() const;
-  void updateAllCells();
-
-  template <typename T>
-  void sortAndUnique(std::vector<T> & data) const
-  {
-    std::sort(data.begin(), data.end());
-    data.erase(std::unique(data.begin(), data.end()), data.end());
-  }
-  template <typename T>
-  void append(std::vector<T> & v0, const std::vector<T> & v1) const
-  {
-    v0.insert(v0.end(), v1.begin(), v1.end());
-  }
-  template <typename T>
-  std::vector<T> concat(const std::vector<T> & v0, const std::vector<T> & v1) const
-  {
-    std::vector<T> ret = v0;
-    ret.insert(ret.end(), v1.begin(), v1.end());
-    return ret;
-  }
 };
 }  // namespace simple_sensor_simulator
 
@@ -44,6 +44,7 @@ public:
     auto primitive_ptr = std::make_unique<T>(std::forward<Ts>(xs)...);
     primitive_ptrs_.emplace(name, std::move(primitive_ptr));
   }
+  void clearPrimitives() { primitive_ptrs_.clear(); }
   const simulation_api_schema::OccupancyGridSensorConfiguration configuration;
 
 private:
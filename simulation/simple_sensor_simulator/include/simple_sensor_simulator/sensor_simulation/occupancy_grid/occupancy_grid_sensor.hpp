@@ -20,6 +20,7 @@
 #include <memory>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <rclcpp/rclcpp.hpp>
+#include <simple_sensor_simulator/sensor_simulation/occupancy_grid/occupancy_grid_generator.hpp>
 #include <string>
 #include <vector>
 
@@ -44,6 +45,11 @@ protected:
 public:
   virtual ~OccupancyGridSensorBase() = default;
 
+  auto getConfiguration() const -> const simulation_api_schema::OccupancyGridSensorConfiguration &
+  {
+    return configuration_;
+  }
+
   virtual void update(
     const double, const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
     const std::vector<std::string> & lidar_detected_entity) = 0;
@@ -59,6 +65,8 @@ class OccupancyGridSensor : public OccupancyGridSensorBase
 {
   const typename rclcpp::Publisher<T>::SharedPtr publisher_ptr_;
 
+  OccupancyGridGenerator generator_;
+
   auto getOccupancyGrid(
     const std::vector<traffic_simulator_msgs::EntityStatus> &, const rclcpp::Time &,
     const std::vector<std::string> &) -> T;
@@ -68,7 +76,9 @@ public:
     const double current_time,
     const simulation_api_schema::OccupancyGridSensorConfiguration & configuration,
     const typename rclcpp::Publisher<T>::SharedPtr & publisher_ptr)
-  : OccupancyGridSensorBase(current_time, configuration), publisher_ptr_(publisher_ptr)
+  : OccupancyGridSensorBase(current_time, configuration),
+    publisher_ptr_(publisher_ptr),
+    generator_(configuration)
   {
   }
 
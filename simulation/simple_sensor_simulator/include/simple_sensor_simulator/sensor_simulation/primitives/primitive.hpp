@@ -53,8 +53,9 @@ public:
   Primitive(std::string type, const geometry_msgs::msg::Pose & pose);
   virtual ~Primitive() = default;
   const std::string type;
-  const geometry_msgs::msg::Pose pose;
+  geometry_msgs::msg::Pose pose;
   unsigned int addToScene(RTCDevice device, RTCScene scene);
+  RTCScene createLocalScene(RTCDevice device) const;
   std::vector<Vertex> getVertex() const;
   std::vector<Triangle> getTriangles() const;
   std::vector<geometry_msgs::msg::Point> get2DConvexHull() const;
@@ -74,6 +75,7 @@ protected:
   std::vector<Triangle> triangles_;
 
 private:
+  RTCGeometry createGeometry(RTCDevice device, const std::vector<Vertex> & vertices) const;
   Vertex transform(const Vertex & v) const;
   Vertex transform(const Vertex & v, const geometry_msgs::msg::Pose & sensor_pose) const;
 };
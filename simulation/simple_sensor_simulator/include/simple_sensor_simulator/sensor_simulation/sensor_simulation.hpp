@@ -23,6 +23,7 @@
 #include <simple_sensor_simulator/sensor_simulation/detection_sensor/detection_sensor.hpp>
 #include <simple_sensor_simulator/sensor_simulation/lidar/lidar_sensor.hpp>
 #include <simple_sensor_simulator/sensor_simulation/occupancy_grid/occupancy_grid_sensor.hpp>
+#include <simple_sensor_simulator/thread_pool.hpp>
 #include <vector>
 
 namespace simple_sensor_simulator
@@ -38,7 +39,8 @@ public:
       lidar_sensors_.push_back(std::make_unique<LidarSensor<sensor_msgs::msg::PointCloud2>>(
         current_simulation_time, configuration,
         node.create_publisher<sensor_msgs::msg::PointCloud2>(
-          "/perception/obstacle_segmentation/pointcloud", 1)));
+          "/perception/obstacle_segmentation/pointcloud", 1),
+        thread_pool_));
     } else {
       std::stringstream ss;
       ss << "Unexpected architecture_type " << std::quoted(configuration.architecture_type())
@@ -83,11 +85,14 @@ public:
     }
   }
 
-  void updateSensorFrame(
+  auto updateSensorFrame(
     double current_time, const rclcpp::Time & current_ros_time,
-    const std::vector<traffic_simulator_msgs::EntityStatus> & status);
+    const std::vector<traffic_simulator_msgs::EntityStatus> & status)
+    -> std::vector<simulation_api_schema::SensorFrameTiming>;
 
 private:
+  // shared by the per-sensor tasks and the rays of every LiDAR, so the total is bounded
+  const std::shared_ptr<ThreadPool> thread_pool_ = std::make_shared<ThreadPool>();
   std::vector<std::unique_ptr<LidarSensorBase>> lidar_sensors_;
   std::vector<std::unique_ptr<DetectionSensorBase>> detection_sensors_;
   std::vector<std::unique_ptr<OccupancyGridSensorBase>> occupancy_grid_sensors_;
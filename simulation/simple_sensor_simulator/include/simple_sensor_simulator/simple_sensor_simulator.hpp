@@ -29,6 +29,7 @@
 #include <simulation_interface/zmq_multi_server.hpp>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 #include <visualization_msgs/msg/marker_array.hpp>
 
@@ -132,6 +133,7 @@ private:
   rclcpp::Time current_ros_time_;
   bool initialized_;
   std::vector<traffic_simulator_msgs::EntityStatus> entity_status_;
+  std::unordered_map<std::string, std::size_t> entity_status_index_;
   zeromq::MultiServer server_;
 };
 }  // namespace simple_sensor_simulator
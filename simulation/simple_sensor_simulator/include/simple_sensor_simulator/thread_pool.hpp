@@ -0,0 +1,69 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_SENSOR_SIMULATOR__THREAD_POOL_HPP_
+#define SIMPLE_SENSOR_SIMULATOR__THREAD_POOL_HPP_
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace simple_sensor_simulator
+{
+/*
+   A fixed set of worker threads that are started once and reused for every
+   frame.
+
+   ThreadPool::parallelFor runs function(0) ... function(count - 1) and blocks
+   until all of them have returned. The calling thread takes indices itself
+   while it waits, and only waits for indices other threads have already
+   started, so parallelFor may be called from inside another parallelFor on
+   the same pool without running out of workers.
+*/
+class ThreadPool
+{
+public:
+  explicit ThreadPool(std::size_t size = std::thread::hardware_concurrency());
+
+  ThreadPool(const ThreadPool &) = delete;
+
+  ThreadPool & operator=(const ThreadPool &) = delete;
+
+  ~ThreadPool();
+
+  // the number of threads that may run a parallelFor at once, including the calling thread
+  auto concurrency() const noexcept -> std::size_t { return workers_.size() + 1; }
+
+  auto parallelFor(std::size_t count, const std::function<void(std::size_t)> & function) -> void;
+
+private:
+  auto post(std::function<void()> task) -> void;
+
+  std::vector<std::thread> workers_;
+
+  std::deque<std::function<void()>> tasks_;
+
+  std::mutex mutex_;
+
+  std::condition_variable condition_;
+
+  bool stopped_ = false;
+};
+}  // namespace simple_sensor_simulator
+
+#endif  // SIMPLE_SENSOR_SIMULATOR__THREAD_POOL_HPP_
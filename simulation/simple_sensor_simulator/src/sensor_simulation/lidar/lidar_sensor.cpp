@@ -21,17 +21,18 @@
 #include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
 #include <simulation_interface/conversions.hpp>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace simple_sensor_simulator
 {
 template <>
 auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
-  const std::vector<traffic_simulator_msgs::EntityStatus> & status, const rclcpp::Time & stamp)
-  -> sensor_msgs::msg::PointCloud2
+  const std::vector<traffic_simulator_msgs::EntityStatus> & status, const rclcpp::Time & stamp,
+  sensor_msgs::msg::PointCloud2 & pointcloud) -> void
 {
-  Raycaster raycaster;
   boost::optional<geometry_msgs::msg::Pose> ego_pose;
+  std::unordered_set<std::string> entity_names;
   for (const auto & s : status) {
     if (configuration_.entity() == s.name()) {
       geometry_msgs::msg::Pose pose;
@@ -48,9 +49,19 @@ auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
       pose.position.x = pose.position.x + center.x();
       pose.position.y = pose.position.y + center.y();
       pose.position.z = pose.position.z + center.z();
-      raycaster.addPrimitive<simple_sensor_simulator::primitives::Box>(
-        s.name(), s.bounding_box().dimensions().x(), s.bounding_box().dimensions().y(),
-        s.bounding_box().dimensions().z(), pose);
+      if (raycaster_.hasPrimitive(s.name())) {
+        raycaster_.setPrimitivePose(s.name(), pose);
+      } else {
+        raycaster_.addPrimitive<simple_sensor_simulator::primitives::Box>(
+          s.name(), s.bounding_box().dimensions().x(), s.bounding_box().dimensions().y(),
+          s.bounding_box().dimensions().z(), pose);
+      }
+      entity_names.emplace(s.name());
+    }
+  }
+  for (const auto & name : raycaster_.getPrimitiveNames()) {
+    if (entity_names.count(name) == 0) {
+      raycaster_.removePrimitive(name);
     }
   }
   if (ego_pose) {
@@ -58,10 +69,11 @@ auto LidarSensor<sensor_msgs::msg::PointCloud2>::raycast(
     for (const auto v : configuration_.vertical_angles()) {
       vertical_angles.emplace_back(v);
     }
-    const auto pointcloud = raycaster.raycast(
-      "base_link", stamp, ego_pose.get(), configuration_.horizontal_resolution(), vertical_angles);
-    detected_objects_ = raycaster.getDetectedObject();
-    return pointcloud;
+    raycaster_.raycast(
+      pointcloud, "base_link", stamp, ego_pose.get(), configuration_.horizontal_resolution(),
+      vertical_angles);
+    detected_objects_ = raycaster_.getDetectedObject();
+    return;
   }
   throw simple_sensor_simulator::SimulationRuntimeError("failed to found ego vehicle");
 }
@@ -15,7 +15,10 @@
 #include <quaternion_operation/quaternion_operation.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
 #include <simple_sensor_simulator/sensor_simulation/lidar/lidar_sensor.hpp>
 #include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
 #include <string>
@@ -25,99 +28,283 @@
 
 namespace simple_sensor_simulator
 {
-Raycaster::Raycaster() : primitive_ptrs_(0), device_(nullptr), scene_(nullptr), engine_(seed_gen_())
+namespace
+{
+constexpr std::size_t packet_size = 16;
+
+constexpr std::size_t minimum_rays_per_chunk = 4096;
+
+void setInstanceTransform(RTCGeometry instance, const geometry_msgs::msg::Pose & pose)
+{
+  const auto rotation = quaternion_operation::getRotationMatrix(pose.orientation);
+  // 3x4 column major affine transform, see rtcSetGeometryTransform
+  const float transform[12] = {
+    static_cast<float>(rotation(0, 0)), static_cast<float>(rotation(1, 0)),
+    static_cast<float>(rotation(2, 0)), static_cast<float>(rotation(0, 1)),
+    static_cast<float>(rotation(1, 1)), static_cast<float>(rotation(2, 1)),
+    static_cast<float>(rotation(0, 2)), static_cast<float>(rotation(1, 2)),
+    static_cast<float>(rotation(2, 2)), static_cast<float>(pose.position.x),
+    static_cast<float>(pose.position.y), static_cast<float>(pose.position.z)};
+  rtcSetGeometryTransform(instance, 0, RTC_FORMAT_FLOAT3X4_COLUMN_MAJOR, transform);
+  rtcCommitGeometry(instance);
+}
+}  // namespace
+
+Raycaster::Raycaster()
+: primitive_ptrs_(0),
+  device_(nullptr),
+  scene_(nullptr),
+  engine_(seed_gen_()),
+  thread_pool_(std::make_shared<ThreadPool>())
 {
   device_ = rtcNewDevice(nullptr);
+  scene_ = rtcNewScene(device_);
+  rtcSetSceneFlags(scene_, RTC_SCENE_FLAG_DYNAMIC);
+  rtcSetSceneBuildQuality(scene_, RTC_BUILD_QUALITY_LOW);
 }
 
 Raycaster::Raycaster(std::string embree_config)
-: primitive_ptrs_(0), device_(nullptr), scene_(nullptr), engine_(seed_gen_())
+: primitive_ptrs_(0),
+  device_(nullptr),
+  scene_(nullptr),
+  engine_(seed_gen_()),
+  thread_pool_(std::make_shared<ThreadPool>())
 {
   device_ = rtcNewDevice(embree_config.c_str());
+  scene_ = rtcNewScene(device_);
+  rtcSetSceneFlags(scene_, RTC_SCENE_FLAG_DYNAMIC);
+  rtcSetSceneBuildQuality(scene_, RTC_BUILD_QUALITY_LOW);
 }
 
-Raycaster::~Raycaster() { rtcReleaseDevice(device_); }
+Raycaster::Raycaster(const std::shared_ptr<ThreadPool> & thread_pool)
+: primitive_ptrs_(0),
+  device_(nullptr),
+  scene_(nullptr),
+  engine_(seed_gen_()),
+  thread_pool_(thread_pool)
+{
+  device_ = rtcNewDevice(nullptr);
+  scene_ = rtcNewScene(device_);
+  rtcSetSceneFlags(scene_, RTC_SCENE_FLAG_DYNAMIC);
+  rtcSetSceneBuildQuality(scene_, RTC_BUILD_QUALITY_LOW);
+}
 
-const sensor_msgs::msg::PointCloud2 Raycaster::raycast(
-  std::string frame_id, const rclcpp::Time & stamp, geometry_msgs::msg::Pose origin,
-  double horizontal_resolution, std::vector<double> vertical_angles, double horizontal_angle_start,
-  double horizontal_angle_end, double max_distance, double min_distance)
+Raycaster::~Raycaster()
+{
+  for (auto & instance : instances_) {
+    rtcReleaseScene(instance.second.scene);
+  }
+  rtcReleaseScene(scene_);
+  rtcReleaseDevice(device_);
+}
+
+void Raycaster::attachPrimitive(const std::string & name, const primitives::Primitive & primitive)
+{
+  RTCScene local_scene = primitive.createLocalScene(device_);
+  RTCGeometry instance = rtcNewGeometry(device_, RTC_GEOMETRY_TYPE_INSTANCE);
+  rtcSetGeometryInstancedScene(instance, local_scene);
+  // enable raycasting
+  rtcSetGeometryMask(instance, 0b11111111'11111111'11111111'11111111);
+  setInstanceTransform(instance, primitive.pose);
+  const auto geometry_id = rtcAttachGeometry(scene_, instance);
+  rtcReleaseGeometry(instance);
+  instances_.emplace(name, Instance{local_scene, geometry_id});
+  geometry_ids_[geometry_id] = name;
+}
+
+bool Raycaster::hasPrimitive(const std::string & name) const
+{
+  return primitive_ptrs_.count(name) != 0;
+}
+
+void Raycaster::setPrimitivePose(const std::string & name, const geometry_msgs::msg::Pose & pose)
+{
+  const auto primitive = primitive_ptrs_.find(name);
+  if (primitive == primitive_ptrs_.end()) {
+    throw std::runtime_error("primitive " + name + " does not exist.");
+  }
+  primitive->second->pose = pose;
+  setInstanceTransform(rtcGetGeometry(scene_, instances_.at(name).geometry_id), pose);
+}
+
+void Raycaster::removePrimitive(const std::string & name)
+{
+  const auto instance = instances_.find(name);
+  if (instance == instances_.end()) {
+    throw std::runtime_error("primitive " + name + " does not exist.");
+  }
+  rtcDetachGeometry(scene_, instance->second.geometry_id);
+  rtcReleaseScene(instance->second.scene);
+  geometry_ids_.erase(instance->second.geometry_id);
+  instances_.erase(instance);
+  primitive_ptrs_.erase(name);
+}
+
+std::vector<std::string> Raycaster::getPrimitiveNames() const
 {
-  std::vector<geometry_msgs::msg::Quaternion> directions;
+  std::vector<std::string> names;
+  for (const auto & pair : primitive_ptrs_) {
+    names.emplace_back(pair.first);
+  }
+  return names;
+}
+
+void Raycaster::setDirections(
+  double horizontal_resolution, const std::vector<double> & vertical_angles,
+  double horizontal_angle_start, double horizontal_angle_end)
+{
+  if (
+    directions_.cols() != 0 && horizontal_resolution_ == horizontal_resolution &&
+    vertical_angles_ == vertical_angles && horizontal_angle_start_ == horizontal_angle_start &&
+    horizontal_angle_end_ == horizontal_angle_end) {
+    return;
+  }
+  horizontal_resolution_ = horizontal_resolution;
+  vertical_angles_ = vertical_angles;
+  horizontal_angle_start_ = horizontal_angle_start;
+  horizontal_angle_end_ = horizontal_angle_end;
+  std::vector<double> horizontal_angles;
   double horizontal_angle = horizontal_angle_start;
   while (horizontal_angle <= (horizontal_angle_end)) {
     horizontal_angle = horizontal_angle + horizontal_resolution;
+    horizontal_angles.emplace_back(horizontal_angle);
+  }
+  directions_.resize(3, horizontal_angles.size() * vertical_angles.size());
+  Eigen::Index index = 0;
+  for (const auto horizontal_angle : horizontal_angles) {
     for (const auto vertical_angle : vertical_angles) {
-      geometry_msgs::msg::Vector3 rpy;
-      rpy.x = 0;
-      rpy.y = vertical_angle;
-      rpy.z = horizontal_angle;
-      auto quat = quaternion_operation::convertEulerAngleToQuaternion(rpy);
-      directions.emplace_back(quat);
+      // unit x vector rotated by roll = 0, pitch = vertical angle, yaw = horizontal angle
+      directions_.col(index++) << std::cos(vertical_angle) * std::cos(horizontal_angle),
+        std::cos(vertical_angle) * std::sin(horizontal_angle), -std::sin(vertical_angle);
     }
   }
-  return raycast(frame_id, stamp, origin, directions, max_distance, min_distance);
 }
 
-const std::vector<std::string> & Raycaster::getDetectedObject() const { return detected_objects_; }
-
 const sensor_msgs::msg::PointCloud2 Raycaster::raycast(
   std::string frame_id, const rclcpp::Time & stamp, geometry_msgs::msg::Pose origin,
-  std::vector<geometry_msgs::msg::Quaternion> directions, double max_distance, double min_distance)
+  double horizontal_resolution, std::vector<double> vertical_angles, double horizontal_angle_start,
+  double horizontal_angle_end, double max_distance, double min_distance)
 {
-  detected_objects_ = {};
-  std::vector<unsigned int> detected_ids = {};
-  scene_ = rtcNewScene(device_);
-  pcl::PointCloud<pcl::PointXYZI>::Ptr cloud(new pcl::PointCloud<pcl::PointXYZI>());
-  for (auto & pair : primitive_ptrs_) {
-    auto id = pair.second->addToScene(device_, scene_);
-    geometry_ids_.insert({id, pair.first});
-  }
+  sensor_msgs::msg::PointCloud2 pointcloud_msg;
+  raycast(
+    pointcloud_msg, frame_id, stamp, origin, horizontal_resolution, vertical_angles,
+    horizontal_angle_start, horizontal_angle_end, max_distance, min_distance);
+  return pointcloud_msg;
+}
+
+void Raycaster::raycast(
+  sensor_msgs::msg::PointCloud2 & pointcloud_msg, std::string frame_id, const rclcpp::Time & stamp,
+  geometry_msgs::msg::Pose origin, double horizontal_resolution,
+  std::vector<double> vertical_angles, double horizontal_angle_start, double horizontal_angle_end,
+  double max_distance, double min_distance)
+{
+  setDirections(
+    horizontal_resolution, vertical_angles, horizontal_angle_start, horizontal_angle_end);
+  castRays(origin, max_distance, min_distance);
+  writePointCloud(pointcloud_msg);
+  pointcloud_msg.header.frame_id = frame_id;
+  pointcloud_msg.header.stamp = stamp;
+}
+
+const std::vector<std::string> & Raycaster::getDetectedObject() const { return detected_objects_; }
+
+void Raycaster::castRays(
+  const geometry_msgs::msg::Pose & origin, double max_distance, double min_distance)
+{
+  // only the top level acceleration structure over the instances is rebuilt here
   rtcCommitScene(scene_);
-  RTCIntersectContext context;
-  rtcInitIntersectContext(&context);
-  for (const auto & direction : directions) {
-    RTCRayHit rayhit = {};
-    rayhit.ray.org_x = origin.position.x;
-    rayhit.ray.org_y = origin.position.y;
-    rayhit.ray.org_z = origin.position.z;
-    // make raycast interact with all objects
-    rayhit.ray.mask = 0b11111111'11111111'11111111'11111111;
-    rayhit.ray.tfar = max_distance;
-    rayhit.ray.tnear = min_distance;
-    rayhit.ray.flags = false;
-    const auto ray_direction = origin.orientation * direction;
-    const auto rotation_mat = quaternion_operation::getRotationMatrix(ray_direction);
-    const Eigen::Vector3d rotated_direction = rotation_mat * Eigen::Vector3d(1.0, 0.0, 0.0);
-    rayhit.ray.dir_x = rotated_direction[0];
-    rayhit.ray.dir_y = rotated_direction[1];
-    rayhit.ray.dir_z = rotated_direction[2];
-    rayhit.hit.geomID = RTC_INVALID_GEOMETRY_ID;
-    rtcIntersect1(scene_, &context, &rayhit);
-    if (rayhit.hit.geomID != RTC_INVALID_GEOMETRY_ID) {
-      double distance = rayhit.ray.tfar;
-      const Eigen::Vector3d vector = quaternion_operation::getRotationMatrix(direction) *
-                                     Eigen::Vector3d(1.0, 0.0, 0.0) * distance;
-      pcl::PointXYZI p;
-      {
-        p.x = vector[0];
-        p.y = vector[1];
-        p.z = vector[2];
+  const Eigen::Matrix3Xf rotated_directions =
+    quaternion_operation::getRotationMatrix(origin.orientation).cast<float>() * directions_;
+  const auto ray_count = static_cast<std::size_t>(directions_.cols());
+  distances_.resize(ray_count);
+  hit_ids_.assign(ray_count, RTC_INVALID_GEOMETRY_ID);
+  const auto intersect = [&](std::size_t begin, std::size_t end) {
+    RTCIntersectContext context;
+    rtcInitIntersectContext(&context);
+    context.flags = RTC_INTERSECT_CONTEXT_FLAG_COHERENT;
+    for (std::size_t offset = begin; offset < end; offset += packet_size) {
+      alignas(64) int valid[packet_size];
+      RTCRayHit16 rayhit;
+      for (std::size_t i = 0; i < packet_size; ++i) {
+        const auto index = offset + i;
+        if (end <= index) {
+          valid[i] = 0;
+          continue;
+        }
+        valid[i] = -1;
+        rayhit.ray.org_x[i] = origin.position.x;
+        rayhit.ray.org_y[i] = origin.position.y;
+        rayhit.ray.org_z[i] = origin.position.z;
+        rayhit.ray.dir_x[i] = rotated_directions(0, index);
+        rayhit.ray.dir_y[i] = rotated_directions(1, index);
+        rayhit.ray.dir_z[i] = rotated_directions(2, index);
+        // make raycast interact with all objects
+        rayhit.ray.mask[i] = 0b11111111'11111111'11111111'11111111;
+        rayhit.ray.tfar[i] = max_distance;
+        rayhit.ray.tnear[i] = min_distance;
+        rayhit.ray.time[i] = 0;
+        rayhit.ray.flags[i] = 0;
+        rayhit.hit.geomID[i] = RTC_INVALID_GEOMETRY_ID;
+        rayhit.hit.instID[0][i] = RTC_INVALID_GEOMETRY_ID;
       }
-      cloud->emplace_back(p);
-      if (std::count(detected_ids.begin(), detected_ids.end(), rayhit.hit.geomID) == 0) {
-        detected_ids.emplace_back(rayhit.hit.geomID);
+      rtcIntersect16(valid, scene_, &context, &rayhit);
+      for (std::size_t i = 0; i < packet_size && offset + i < end; ++i) {
+        if (rayhit.hit.geomID[i] != RTC_INVALID_GEOMETRY_ID) {
+          distances_[offset + i] = rayhit.ray.tfar[i];
+          hit_ids_[offset + i] = rayhit.hit.instID[0][i];
+        }
       }
     }
+  };
+  // each chunk is a contiguous range of whole packets, results are written per ray index
+  const auto rays_per_chunk = std::max<std::size_t>(
+    minimum_rays_per_chunk,
+    (ray_count / thread_pool_->concurrency() + packet_size - 1) / packet_size * packet_size);
+  thread_pool_->parallelFor(
+    (ray_count + rays_per_chunk - 1) / rays_per_chunk, [&](const std::size_t chunk) {
+      const auto begin = chunk * rays_per_chunk;
+      intersect(begin, std::min(begin + rays_per_chunk, ray_count));
+    });
+}
+
+void Raycaster::writePointCloud(sensor_msgs::msg::PointCloud2 & pointcloud_msg)
+{
+  if (pointcloud_msg.fields.size() != 4) {
+    sensor_msgs::PointCloud2Modifier modifier(pointcloud_msg);
+    modifier.setPointCloud2Fields(
+      4, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1,
+      sensor_msgs::msg::PointField::FLOAT32, "z", 1, sensor_msgs::msg::PointField::FLOAT32,
+      "intensity", 1, sensor_msgs::msg::PointField::FLOAT32);
   }
-  for (const auto & id : detected_ids) {
-    detected_objects_.emplace_back(geometry_ids_[id]);
+  const auto point_count = static_cast<std::size_t>(
+    std::count_if(hit_ids_.begin(), hit_ids_.end(), [](const auto id) {
+      return id != RTC_INVALID_GEOMETRY_ID;
+    }));
+  pointcloud_msg.height = 1;
+  pointcloud_msg.width = point_count;
+  pointcloud_msg.is_bigendian = false;
+  pointcloud_msg.is_dense = true;
+  pointcloud_msg.row_step = pointcloud_msg.width * pointcloud_msg.point_step;
+  // reused messages keep their capacity, so this does not reallocate in steady state
+  pointcloud_msg.data.resize(pointcloud_msg.row_step);
+  detected_objects_.clear();
+  detected_ids_.assign(detected_ids_.size(), false);
+  auto data = pointcloud_msg.data.data();
+  for (std::size_t index = 0; index < hit_ids_.size(); ++index) {
+    const auto id = hit_ids_[index];
+    if (id != RTC_INVALID_GEOMETRY_ID) {
+      const Eigen::Vector3f vector = directions_.col(index) * distances_[index];
+      const float point[4] = {vector[0], vector[1], vector[2], 0.0f};
+      std::memcpy(data, point, sizeof(point));
+      data += pointcloud_msg.point_step;
+      if (detected_ids_.size() <= id) {
+        detected_ids_.resize(id + 1, false);
+      }
+      if (!detected_ids_[id]) {
+        detected_ids_[id] = true;
+        detected_objects_.emplace_back(geometry_ids_[id]);
+      }
+    }
   }
-  sensor_msgs::msg::PointCloud2 pointcloud_msg;
-  pcl::toROSMsg(*cloud, pointcloud_msg);
-  rtcReleaseScene(scene_);
-  pointcloud_msg.header.frame_id = frame_id;
-  pointcloud_msg.header.stamp = stamp;
-  return pointcloud_msg;
 }
 }  // namespace simple_sensor_simulator
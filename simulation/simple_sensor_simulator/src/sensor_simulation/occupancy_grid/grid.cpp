@@ -14,11 +14,13 @@
 
 #include <quaternion_operation/quaternion_operation.h>
 
-#include <boost/geometry.hpp>
-#include <boost/geometry/geometries/point_xy.hpp>
-#include <boost/geometry/geometries/polygon.hpp>
-#include <rclcpp/rclcpp.hpp>
+#include <algorithm>
+#include <cmath>
+#include <geometry/polygon/polygon.hpp>
+#include <limits>
 #include <simple_sensor_simulator/sensor_simulation/occupancy_grid/grid.hpp>
+#include <utility>
+#include <vector>
 
 namespace simple_sensor_simulator
 {
@@ -29,13 +31,10 @@ Grid::Grid(
   width(width),
   occupied_cost(occupied_cost),
   invisible_cost(invisible_cost),
-  grid_cells_(height * width)
+  values_(height * width, 0)
 {
-  updateAllCells();
 }
 
-double Grid::getDiagonalLength() const { return std::hypot(width, height) * resolution; }
-
 geometry_msgs::msg::Point Grid::transformToGrid(const geometry_msgs::msg::Point & world_point) const
 {
   auto mat =
@@ -55,30 +54,6 @@ geometry_msgs::msg::Point Grid::transformToGrid(const geometry_msgs::msg::Point
   return ret;
 }
 
-math::geometry::LineSegment Grid::transformToGrid(const math::geometry::LineSegment & line) const
-{
-  return math::geometry::LineSegment(
-    transformToGrid(line.start_point), transformToGrid(line.end_point));
-}
-
-geometry_msgs::msg::Point Grid::transformToWorld(const geometry_msgs::msg::Point & grid_point) const
-{
-  auto mat = quaternion_operation::getRotationMatrix(origin_.orientation);
-  Eigen::VectorXd p(3);
-  p(0) = grid_point.x;
-  p(1) = grid_point.y;
-  p(2) = grid_point.z;
-  p = mat * p;
-  p(0) = p(0) + origin_.position.x;
-  p(1) = p(1) + origin_.position.y;
-  p(2) = p(2) + origin_.position.z;
-  geometry_msgs::msg::Point ret;
-  ret.x = p(0);
-  ret.y = p(1);
-  ret.z = p(2);
-  return ret;
-}
-
 geometry_msgs::msg::Point Grid::transformToPixel(const geometry_msgs::msg::Point & grid_point) const
 {
   geometry_msgs::msg::Point p;
@@ -88,333 +63,138 @@ geometry_msgs::msg::Point Grid::transformToPixel(const geometry_msgs::msg::Point
   return p;
 }
 
-math::geometry::LineSegment Grid::transformToPixel(const math::geometry::LineSegment & line) const
-{
-  return math::geometry::LineSegment(
-    transformToPixel(line.start_point), transformToPixel(line.end_point));
-}
-
-math::geometry::LineSegment Grid::getInvisibleRay(
-  const geometry_msgs::msg::Point & point_on_polygon) const
-{
-  return math::geometry::LineSegment(
-    point_on_polygon, math::geometry::LineSegment(origin_.position, point_on_polygon).get2DVector(),
-    getDiagonalLength());
-}
-
-std::vector<math::geometry::LineSegment> Grid::getInvisibleRay(
-  const std::vector<geometry_msgs::msg::Point> & points) const
-{
-  std::vector<math::geometry::LineSegment> ret = {};
-  for (const auto & point : points) {
-    ret.emplace_back(getInvisibleRay(point));
-  }
-  return ret;
-}
-
-std::vector<math::geometry::LineSegment> Grid::getRayToGridCorner() const
-{
-  geometry_msgs::msg::Point left_up;
-  left_up.x = static_cast<double>(width) * resolution * 0.5;
-  left_up.y = static_cast<double>(height) * resolution * 0.5;
-  left_up = transformToWorld(left_up);
-  geometry_msgs::msg::Point left_down;
-  left_down.x = static_cast<double>(width) * resolution * 0.5;
-  left_down.y = -static_cast<double>(height) * resolution * 0.5;
-  left_down = transformToWorld(left_down);
-  geometry_msgs::msg::Point right_up;
-  right_up.x = -static_cast<double>(width) * resolution * 0.5;
-  right_up.y = static_cast<double>(height) * resolution * 0.5;
-  right_up = transformToWorld(right_up);
-  geometry_msgs::msg::Point right_down;
-  right_down.x = -static_cast<double>(width) * resolution * 0.5;
-  right_down.y = -static_cast<double>(height) * resolution * 0.5;
-  right_down = transformToWorld(right_down);
-  return {
-    math::geometry::LineSegment(origin_.position, left_up),
-    math::geometry::LineSegment(origin_.position, left_down),
-    math::geometry::LineSegment(origin_.position, right_down),
-    math::geometry::LineSegment(origin_.position, right_up)};
-}
-
-size_t Grid::getIndex(size_t row, size_t col) const { return width * col + row; }
-size_t Grid::getNextRowIndex(size_t row, size_t col) const { return width * col + (row + 1); }
-size_t Grid::getNextColIndex(size_t row, size_t col) const { return width * (col + 1) + row; }
-size_t Grid::getPreviousRowIndex(size_t row, size_t col) const { return width * col + (row - 1); }
-size_t Grid::getPreviousColIndex(size_t row, size_t col) const { return width * (col - 1) + row; }
-bool Grid::indexExist(size_t index) const
-{
-  if (index <= (height * width - 1)) {
-    return true;
-  }
-  return false;
-}
-
-std::vector<std::pair<size_t, size_t>> Grid::fillByIntersection(
-  const math::geometry::LineSegment & line_segment, int8_t data)
-{
-  std::vector<std::pair<size_t, size_t>> ret;
-  const auto line_segment_pixel = transformToPixel(transformToGrid(line_segment));
-  int start_row = std::floor(line_segment_pixel.start_point.x);
-  int start_col = std::floor(line_segment_pixel.start_point.y);
-  int end_row = std::floor(line_segment_pixel.end_point.x);
-  int end_col = std::floor(line_segment_pixel.end_point.y);
-  if (start_row == end_row) {
-    for (int col = start_col; col <= end_col; col++) {
-      if (fillByRowCol(start_row, col, data)) {
-        ret.emplace_back(std::pair<size_t, size_t>({start_row, col}));
-      }
+/**
+ * @brief Get the area hidden by the convex polygon seen from the sensor, including the polygon
+ * itself. It is the wedge between the two outermost rays from the sensor touching the polygon, cut
+ * by the near side of the polygon, which is a convex polygon. The outermost rays are found by one
+ * sweep over the angles of the vertices, and the wedge is closed by points far outside the grid.
+ * @param polygon convex polygon in pixel coordinates
+ * @return std::vector<geometry_msgs::msg::Point> convex polygon in pixel coordinates
+ */
+std::vector<geometry_msgs::msg::Point> Grid::getInvisibleArea(
+  const std::vector<geometry_msgs::msg::Point> & polygon) const
+{
+  if (polygon.empty()) {
+    return polygon;
+  }
+  const auto sensor = transformToPixel(transformToGrid(origin_.position));
+  geometry_msgs::msg::Point centroid;
+  for (const auto & point : polygon) {
+    centroid.x = centroid.x + point.x / polygon.size();
+    centroid.y = centroid.y + point.y / polygon.size();
+  }
+  const double reference_angle = std::atan2(centroid.y - sensor.y, centroid.x - sensor.x);
+  const auto get_angle = [&](const geometry_msgs::msg::Point & point) {
+    return std::remainder(
+      std::atan2(point.y - sensor.y, point.x - sensor.x) - reference_angle, 2 * M_PI);
+  };
+  double min_angle = 0;
+  double max_angle = 0;
+  double max_distance = 0;
+  for (const auto & point : polygon) {
+    const auto angle = get_angle(point);
+    min_angle = std::min(min_angle, angle);
+    max_angle = std::max(max_angle, angle);
+    max_distance = std::max(max_distance, std::hypot(point.x - sensor.x, point.y - sensor.y));
+  }
+  if (max_angle - min_angle >= M_PI) {
+    /**
+     * @note The sensor is inside of the polygon, so nothing is hidden behind it.
+     */
+    return polygon;
+  }
+  /**
+   * @note The far points are placed far enough that the edges between them never cross the grid.
+   */
+  const double far_distance = max_distance + 10.0 * std::hypot(width, height);
+  const auto get_far_point = [&](double angle) {
+    geometry_msgs::msg::Point point;
+    point.x = sensor.x + far_distance * std::cos(reference_angle + angle);
+    point.y = sensor.y + far_distance * std::sin(reference_angle + angle);
+    return point;
+  };
+  auto points = polygon;
+  points.emplace_back(get_far_point(min_angle));
+  points.emplace_back(get_far_point(max_angle));
+  for (const auto & [x_index, y_index] : std::vector<std::pair<size_t, size_t>>{
+         {0, 0}, {width, 0}, {width, height}, {0, height}}) {
+    geometry_msgs::msg::Point corner;
+    corner.x = x_index;
+    corner.y = y_index;
+    if (const auto angle = get_angle(corner); min_angle < angle && angle < max_angle) {
+      points.emplace_back(get_far_point(angle));
     }
-    sortAndUnique(ret);
-    return ret;
   }
-  if (start_col == end_col) {
-    for (int row = start_row; row <= end_row; row++) {
-      if (fillByRowCol(row, start_col, data)) {
-        ret.emplace_back(std::pair<size_t, size_t>({row, start_col}));
+  return math::geometry::get2DConvexHull(points);
+}
+
+/**
+ * @brief Fill every cell touched by the convex polygon. Each row of cells is a band in which the
+ * polygon spans one range of columns, bounded by the edges clipped to the band, so each row is
+ * written with a single contiguous fill.
+ * @param polygon convex polygon in pixel coordinates
+ */
+void Grid::fillPolygon(const std::vector<geometry_msgs::msg::Point> & polygon, int8_t data)
+{
+  if (polygon.empty()) {
+    return;
+  }
+  const auto [min_point, max_point] = std::minmax_element(
+    polygon.begin(), polygon.end(), [](const auto & a, const auto & b) { return a.y < b.y; });
+  const auto clamp_index = [](double value, size_t size) {
+    return static_cast<size_t>(std::clamp(std::floor(value), 0.0, static_cast<double>(size - 1)));
+  };
+  if (max_point->y < 0 || min_point->y >= height) {
+    return;
+  }
+  const auto last_y_index = clamp_index(max_point->y, height);
+  for (auto y_index = clamp_index(min_point->y, height); y_index <= last_y_index; y_index++) {
+    const double lower = std::max<double>(y_index, min_point->y);
+    const double upper = std::min<double>(y_index + 1, max_point->y);
+    double min_x = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    for (size_t i = 0; i < polygon.size(); i++) {
+      const auto & p0 = polygon[i];
+      const auto & p1 = polygon[(i + 1) % polygon.size()];
+      const double y0 = std::max(std::min(p0.y, p1.y), lower);
+      const double y1 = std::min(std::max(p0.y, p1.y), upper);
+      if (y0 > y1) {
+        continue;
       }
-    }
-    sortAndUnique(ret);
-    return ret;
-  }
-  for (int row = std::min(start_row, end_row) + 1; row < std::max(start_row, end_row) + 1; row++) {
-    if (0 <= row && row < static_cast<int>(width)) {
-      int col = std::floor(
-        line_segment_pixel.getSlope() * static_cast<double>(row) +
-        line_segment_pixel.getIntercept());
-      if (0 <= col && col < static_cast<int>(height)) {
-        if (fillByRowCol(row, col, data)) {
-          ret.emplace_back(std::pair<size_t, size_t>({row, col}));
-        }
-        if (row != std::max(start_row, end_row)) {
-          if (fillByRowCol(row - 1, col, data)) {
-            ret.emplace_back(std::pair<size_t, size_t>({row - 1, col}));
-          }
+      if (p0.y == p1.y) {
+        min_x = std::min({min_x, p0.x, p1.x});
+        max_x = std::max({max_x, p0.x, p1.x});
+      } else {
+        for (const auto y : {y0, y1}) {
+          const double x = p0.x + (p1.x - p0.x) * (y - p0.y) / (p1.y - p0.y);
+          min_x = std::min(min_x, x);
+          max_x = std::max(max_x, x);
         }
       }
     }
-  }
-  for (int col = std::min(start_col, end_col) + 1; col < std::max(start_col, end_col) + 1; col++) {
-    if (0 <= col && col < static_cast<int>(height)) {
-      int row = std::floor(
-        (static_cast<double>(col) - line_segment_pixel.getIntercept()) /
-        line_segment_pixel.getSlope());
-      if (0 <= row && row < static_cast<int>(width)) {
-        if (fillByRowCol(row, col, data)) {
-          ret.emplace_back(std::pair<size_t, size_t>({row, col}));
-        }
-        if (col != std::max(start_col, end_col)) {
-          if (fillByRowCol(row, col - 1, data)) {
-            ret.emplace_back(std::pair<size_t, size_t>({row, col - 1}));
-          }
-        }
-      }
+    if (min_x > max_x || max_x < 0 || min_x >= width) {
+      continue;
     }
+    const auto begin = values_.begin() + y_index * width;
+    std::fill(begin + clamp_index(min_x, width), begin + clamp_index(max_x, width) + 1, data);
   }
-  sortAndUnique(ret);
-  return ret;
-}
-
-std::vector<std::pair<size_t, size_t>> Grid::fillByIntersection(
-  const std::vector<math::geometry::LineSegment> & line_segments, int8_t data)
-{
-  std::vector<std::pair<size_t, size_t>> filled_cells = {};
-  for (const auto & line : line_segments) {
-    append(filled_cells, fillByIntersection(line, data));
-  }
-  return filled_cells;
-}
-
-std::vector<std::pair<size_t, size_t>> Grid::fillInside(
-  const std::vector<std::pair<size_t, size_t>> & row_and_cols, int8_t data)
-{
-  auto ret = std::vector<std::pair<size_t, size_t>>();
-
-  auto group_by_row = std::map<size_t, std::vector<size_t>>();
-  for (const auto [row, col] : row_and_cols) {
-    group_by_row[row].emplace_back(col);
-  }
-  for (const auto & [row, cols] : group_by_row) {
-    if (cols.size() <= 1) continue;
-    auto [min_col_itr, max_col_itr] = std::minmax_element(cols.begin(), cols.end());
-    for (auto col = *min_col_itr; col <= *max_col_itr; col++) {
-      if (fillByRowCol(row, col, data)) {
-        ret.emplace_back(row, col);
-      }
-    }
-  }
-
-  auto group_by_col = std::map<size_t, std::vector<size_t>>();
-  for (const auto [row, col] : row_and_cols) {
-    group_by_col[col].emplace_back(row);
-  }
-  for (const auto & [col, rows] : group_by_col) {
-    if (rows.size() <= 1) continue;
-    auto [min_row_itr, max_row_itr] = std::minmax_element(rows.begin(), rows.end());
-    for (auto row = *min_row_itr; row <= *max_row_itr; row++) {
-      if (fillByRowCol(row, col, data)) {
-        ret.emplace_back(row, col);
-      }
-    }
-  }
-
-  return ret;
-}
-
-std::vector<std::pair<size_t, size_t>> Grid::filterByRow(
-  const std::vector<std::pair<size_t, size_t>> & row_and_cols, size_t row) const
-{
-  std::vector<std::pair<size_t, size_t>> filtered;
-  for (const auto & row_and_col : row_and_cols) {
-    if (row_and_col.first == row) {
-      filtered.emplace_back(row_and_col);
-    }
-  }
-  sortAndUnique(filtered);
-  return filtered;
-}
-
-std::vector<std::pair<size_t, size_t>> Grid::filterByCol(
-  const std::vector<std::pair<size_t, size_t>> & row_and_cols, size_t col) const
-{
-  std::vector<std::pair<size_t, size_t>> filtered;
-  for (const auto & row_and_col : row_and_cols) {
-    if (row_and_col.second == col) {
-      filtered.emplace_back(row_and_col);
-    }
-  }
-  sortAndUnique(filtered);
-  return filtered;
-}
-
-std::vector<math::geometry::LineSegment> Grid::filterByIntersection(
-  const std::vector<math::geometry::LineSegment> & source_lines,
-  const std::vector<math::geometry::LineSegment> & filter_lines) const
-{
-  std::vector<math::geometry::LineSegment> filtered_lines;
-  for (const auto & source_line : source_lines) {
-    for (const auto & filter_line : filter_lines) {
-      if (source_line.getIntersection2D(filter_line)) {
-        filtered_lines.emplace_back(source_line);
-        break;
-      }
-    }
-  }
-  return filtered_lines;
-}
-
-std::vector<size_t> Grid::getRows(const std::vector<std::pair<size_t, size_t>> & row_and_cols) const
-{
-  std::vector<size_t> ret;
-  for (const auto & row_and_col : row_and_cols) {
-    ret.emplace_back(row_and_col.first);
-  }
-  sortAndUnique(ret);
-  return ret;
-}
-
-std::vector<size_t> Grid::getCols(const std::vector<std::pair<size_t, size_t>> & row_and_cols) const
-{
-  std::vector<size_t> ret;
-  for (const auto & row_and_col : row_and_cols) {
-    ret.emplace_back(row_and_col.second);
-  }
-  sortAndUnique(ret);
-  return ret;
 }
 
 void Grid::addPrimitive(const std::unique_ptr<primitives::Primitive> & primitive)
 {
-  const auto hull = primitive->get2DConvexHull();
-  const auto line_segments_on_hull = math::geometry::getLineSegments(hull);
-  std::vector<math::geometry::LineSegment> rays_to_grid_corner = {};
-  for (const auto & ray : filterByIntersection(getRayToGridCorner(), line_segments_on_hull)) {
-    for (const auto & line_segment : line_segments_on_hull) {
-      const auto intersection = ray.getIntersection2D(line_segment);
-      if (intersection) {
-        rays_to_grid_corner.emplace_back(
-          math::geometry::LineSegment(intersection.get(), ray.get2DVector(), getDiagonalLength()));
-      }
-    }
-  }
-  fillInside(
-    fillByIntersection(
-      concat(line_segments_on_hull, concat(getInvisibleRay(hull), rays_to_grid_corner)),
-      invisible_cost),
-    invisible_cost);
-  fillInside(fillByIntersection(line_segments_on_hull, occupied_cost), occupied_cost);
-}
-
-std::vector<int8_t> Grid::getData()
-{
-  std::vector<int8_t> data;
-  for (const auto & cell : grid_cells_) {
-    data.emplace_back(cell.getData());
+  std::vector<geometry_msgs::msg::Point> hull;
+  for (const auto & point : primitive->get2DConvexHull()) {
+    hull.emplace_back(transformToPixel(transformToGrid(point)));
   }
-  return data;
+  fillPolygon(getInvisibleArea(hull), invisible_cost);
+  fillPolygon(hull, occupied_cost);
 }
 
-bool Grid::fillByIndex(size_t index, int8_t data)
-{
-  if (index < grid_cells_.size()) {
-    grid_cells_[index].setData(data);
-    return true;
-  }
-  return false;
-}
-
-bool Grid::fillByRowCol(size_t row, size_t col, int8_t data)
-{
-  if (row >= width) {
-    return false;
-  }
-  if (col >= height) {
-    return false;
-  }
-  return fillByIndex(getIndex(row, col), data);
-}
-
-void Grid::fillByRow(size_t row, int8_t data)
-{
-  if (row < height) {
-    for (size_t col = 0; col < width; col++) {
-      fillByRowCol(row, col, data);
-    }
-  }
-}
-
-void Grid::fillByCol(size_t col, int8_t data)
-{
-  if (col < width) {
-    for (size_t row = 0; row < height; row++) {
-      fillByRowCol(row, col, data);
-    }
-  }
-}
+const std::vector<int8_t> & Grid::getData() const { return values_; }
 
 void Grid::updateOrigin(const geometry_msgs::msg::Pose & origin)
 {
   origin_ = origin;
-  updateAllCells();
+  std::fill(values_.begin(), values_.end(), 0);
 }
-
-void Grid::updateAllCells()
-{
-  for (size_t x_index = 0; x_index < height; x_index++) {
-    for (size_t y_index = 0; y_index < width; y_index++) {
-      size_t index = x_index * width + y_index;
-      auto & cell = grid_cells_[index];
-      cell.origin.position.x = origin_.position.x + (x_index - 0.5 * height) * resolution;
-      cell.origin.position.y = origin_.position.y + (y_index - 0.5 * width) * resolution;
-      cell.origin.position.z = origin_.position.z;
-      cell.origin.orientation = origin_.orientation;
-      cell.size = resolution;
-      cell.index = index;
-      cell.row = y_index;
-      cell.col = x_index;
-      cell.setData(0);
-    }
-  }
-}
-
 }  // namespace simple_sensor_simulator
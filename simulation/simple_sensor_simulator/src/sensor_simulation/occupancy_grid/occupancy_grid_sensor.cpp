@@ -67,7 +67,7 @@ auto OccupancyGridSensor<nav_msgs::msg::OccupancyGrid>::getOccupancyGrid(
     detected_objects = lidar_detected_entity;
   }
   boost::optional<geometry_msgs::msg::Pose> ego_pose_north_up;
-  OccupancyGridGenerator generator(configuration_);
+  generator_.clearPrimitives();
   for (const auto & s : status) {
     if (configuration_.entity() == s.name()) {
       geometry_msgs::msg::Pose pose;
@@ -92,13 +92,13 @@ auto OccupancyGridSensor<nav_msgs::msg::OccupancyGrid>::getOccupancyGrid(
       pose.position.x = pose.position.x + center.x();
       pose.position.y = pose.position.y + center.y();
       pose.position.z = pose.position.z + center.z();
-      generator.addPrimitive<simple_sensor_simulator::primitives::Box>(
+      generator_.addPrimitive<simple_sensor_simulator::primitives::Box>(
         s.name(), s.bounding_box().dimensions().x(), s.bounding_box().dimensions().y(),
         s.bounding_box().dimensions().z(), pose);
     }
   }
   if (ego_pose_north_up) {
-    return generator.generate(ego_pose_north_up.get(), stamp);
+    return generator_.generate(ego_pose_north_up.get(), stamp);
   } else {
     throw SimulationRuntimeError("Failed to calculate ego pose with north up.");
   }
@@ -12,32 +12,107 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <simple_sensor_simulator/sensor_simulation/sensor_simulation.hpp>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 namespace simple_sensor_simulator
 {
-void SensorSimulation::updateSensorFrame(
+namespace
+{
+template <typename Function>
+auto measure(
+  const std::string & entity, simulation_api_schema::SensorFrameTiming::SensorType type,
+  Function && function) -> simulation_api_schema::SensorFrameTiming
+{
+  const auto begin = std::chrono::steady_clock::now();
+  function();
+  simulation_api_schema::SensorFrameTiming timing;
+  timing.set_entity(entity);
+  timing.set_type(type);
+  timing.set_elapsed_time(
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count());
+  return timing;
+}
+}  // namespace
+
+auto SensorSimulation::updateSensorFrame(
   double current_time, const rclcpp::Time & current_ros_time,
   const std::vector<traffic_simulator_msgs::EntityStatus> & status)
+  -> std::vector<simulation_api_schema::SensorFrameTiming>
 {
+  using simulation_api_schema::SensorFrameTiming;
+  const std::vector<std::string> no_detected_objects = {};
   std::vector<std::string> lidar_detected_objects = {};
+  std::vector<std::function<SensorFrameTiming()>> tasks;
+  std::vector<SensorFrameTiming> timing;
+  /*
+     Every sensor is a task on the shared thread pool. The only dependency between sensors is that
+     detection and occupancy grid sensors which are not filtered by range consume the objects hit by
+     LiDARs, so only those are run after all LiDAR tasks have finished.
+  */
+  const auto run_tasks = [&]() {
+    const auto offset = timing.size();
+    timing.resize(offset + tasks.size());
+    thread_pool_->parallelFor(
+      tasks.size(), [&](const std::size_t index) { timing[offset + index] = tasks[index](); });
+    tasks.clear();
+  };
+  const auto update_detection_sensor = [&](auto & sensor, const auto & detected_objects) {
+    tasks.emplace_back([&, sensor = sensor.get()] {
+      return measure(sensor->getConfiguration().entity(), SensorFrameTiming::DETECTION, [&] {
+        sensor->update(current_time, status, current_ros_time, detected_objects);
+      });
+    });
+  };
+  const auto update_occupancy_grid_sensor = [&](auto & sensor, const auto & detected_objects) {
+    tasks.emplace_back([&, sensor = sensor.get()] {
+      return measure(sensor->getConfiguration().entity(), SensorFrameTiming::OCCUPANCY_GRID, [&] {
+        sensor->update(current_time, status, current_ros_time, detected_objects);
+      });
+    });
+  };
   for (auto & sensor : lidar_sensors_) {
-    sensor->update(current_time, status, current_ros_time);
-    const auto objects = sensor->getDetectedObjects();
-    for (const auto & obj : objects) {
-      if (std::count(lidar_detected_objects.begin(), lidar_detected_objects.end(), obj) == 0) {
+    tasks.emplace_back([&, sensor = sensor.get()] {
+      return measure(sensor->getConfiguration().entity(), SensorFrameTiming::LIDAR, [&] {
+        sensor->update(current_time, status, current_ros_time);
+      });
+    });
+  }
+  for (auto & sensor : detection_sensors_) {
+    if (sensor->getConfiguration().filter_by_range()) {
+      update_detection_sensor(sensor, no_detected_objects);
+    }
+  }
+  for (auto & sensor : occupancy_grid_sensors_) {
+    if (sensor->getConfiguration().filter_by_range()) {
+      update_occupancy_grid_sensor(sensor, no_detected_objects);
+    }
+  }
+  run_tasks();
+  std::unordered_set<std::string> unique_lidar_detected_objects;
+  for (const auto & sensor : lidar_sensors_) {
+    for (const auto & obj : sensor->getDetectedObjects()) {
+      if (unique_lidar_detected_objects.insert(obj).second) {
         lidar_detected_objects.push_back(obj);
       }
     }
   }
   for (auto & sensor : detection_sensors_) {
-    sensor->update(current_time, status, current_ros_time, lidar_detected_objects);
+    if (!sensor->getConfiguration().filter_by_range()) {
+      update_detection_sensor(sensor, lidar_detected_objects);
+    }
   }
   for (auto & sensor : occupancy_grid_sensors_) {
-    sensor->update(current_time, status, current_ros_time, lidar_detected_objects);
+    if (!sensor->getConfiguration().filter_by_range()) {
+      update_occupancy_grid_sensor(sensor, lidar_detected_objects);
+    }
   }
+  run_tasks();
+  return timing;
 }
 }  // namespace simple_sensor_simulator
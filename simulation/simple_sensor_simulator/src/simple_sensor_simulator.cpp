@@ -32,7 +32,9 @@ ScenarioSimulator::ScenarioSimulator(const rclcpp::NodeOptions & options)
 : Node("simple_sensor_simulator", options),
   sensor_sim_(),
   server_(
-    simulation_interface::protocol, simulation_interface::HostName::ANY,
+    simulation_interface::toTransportProtocol(
+      declare_parameter<std::string>("transport_protocol", "tcp")),
+    simulation_interface::HostName::ANY,
     std::bind(&ScenarioSimulator::initialize, this, std::placeholders::_1, std::placeholders::_2),
     std::bind(&ScenarioSimulator::updateFrame, this, std::placeholders::_1, std::placeholders::_2),
     std::bind(
@@ -77,6 +79,8 @@ void ScenarioSimulator::initialize(
   ego_vehicles_ = {};
   vehicles_ = {};
   pedestrians_ = {};
+  entity_status_ = {};
+  entity_status_index_ = {};
 }
 
 void ScenarioSimulator::updateFrame(
@@ -101,9 +105,22 @@ void ScenarioSimulator::updateEntityStatus(
   const simulation_api_schema::UpdateEntityStatusRequest & req,
   simulation_api_schema::UpdateEntityStatusResponse & res)
 {
-  entity_status_ = {};
-  for (const auto proto : req.status()) {
-    entity_status_.emplace_back(proto);
+  if (!req.is_delta()) {
+    entity_status_.assign(req.status().begin(), req.status().end());
+    entity_status_index_.clear();
+    for (std::size_t i = 0; i < entity_status_.size(); ++i) {
+      entity_status_index_[entity_status_[i].name()] = i;
+    }
+  } else {
+    for (const auto & proto : req.status()) {
+      const auto index = entity_status_index_.find(proto.name());
+      if (index == entity_status_index_.end()) {
+        entity_status_index_.emplace(proto.name(), entity_status_.size());
+        entity_status_.push_back(proto);
+      } else {
+        entity_status_[index->second] = proto;
+      }
+    }
   }
   res = simulation_api_schema::UpdateEntityStatusResponse();
   res.mutable_result()->set_success(true);
@@ -180,6 +197,17 @@ void ScenarioSimulator::despawnEntity(
     }
   }
   misc_objects_ = misc_objects;
+  if (const auto index = entity_status_index_.find(req.name());
+      index != entity_status_index_.end()) {
+    // move the last status into the removed slot to keep the store contiguous
+    const auto removed = index->second;
+    entity_status_index_.erase(index);
+    if (removed + 1 != entity_status_.size()) {
+      entity_status_[removed] = std::move(entity_status_.back());
+      entity_status_index_[entity_status_[removed].name()] = removed;
+    }
+    entity_status_.pop_back();
+  }
   if (found) {
     res.mutable_result()->set_success(true);
   } else {
@@ -226,9 +254,13 @@ void ScenarioSimulator::updateSensorFrame(
   builtin_interfaces::msg::Time t;
   simulation_interface::toMsg(req.current_ros_time(), t);
   current_ros_time_ = t;
-  sensor_sim_.updateSensorFrame(current_time_, current_ros_time_, entity_status_);
+  const auto timing =
+    sensor_sim_.updateSensorFrame(current_time_, current_ros_time_, entity_status_);
   res = simulation_api_schema::UpdateSensorFrameResponse();
   res.mutable_result()->set_success(true);
+  for (const auto & sensor_timing : timing) {
+    *res.add_timing() = sensor_timing;
+  }
 }
 
 void ScenarioSimulator::updateTrafficLights(
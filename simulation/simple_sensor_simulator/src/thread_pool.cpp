@@ -0,0 +1,131 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <simple_sensor_simulator/thread_pool.hpp>
+#include <utility>
+
+namespace simple_sensor_simulator
+{
+ThreadPool::ThreadPool(std::size_t size)
+{
+  // the thread calling parallelFor always takes part, so one thread fewer is started
+  for (std::size_t i = 1; i < size; ++i) {
+    workers_.emplace_back([this] {
+      for (;;) {
+        std::function<void()> task;
+        {
+          std::unique_lock<std::mutex> lock(mutex_);
+          condition_.wait(lock, [this] { return stopped_ || !tasks_.empty(); });
+          if (tasks_.empty()) {
+            return;
+          }
+          task = std::move(tasks_.front());
+          tasks_.pop_front();
+        }
+        task();
+      }
+    });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopped_ = true;
+  }
+  condition_.notify_all();
+  for (auto & worker : workers_) {
+    worker.join();
+  }
+}
+
+auto ThreadPool::post(std::function<void()> task) -> void
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  condition_.notify_one();
+}
+
+auto ThreadPool::parallelFor(std::size_t count, const std::function<void(std::size_t)> & function)
+  -> void
+{
+  struct Job
+  {
+    explicit Job(const std::function<void(std::size_t)> & function, std::size_t count)
+    : function(function), count(count)
+    {
+    }
+
+    const std::function<void(std::size_t)> & function;
+
+    const std::size_t count;
+
+    std::atomic<std::size_t> next{0};
+
+    std::size_t finished = 0;
+
+    std::exception_ptr exception;
+
+    std::mutex mutex;
+
+    std::condition_variable condition;
+
+    auto run() -> void
+    {
+      for (auto index = next++; index < count; index = next++) {
+        std::exception_ptr thrown;
+        try {
+          function(index);
+        } catch (...) {
+          thrown = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (thrown && !exception) {
+          exception = thrown;
+        }
+        if (++finished == count) {
+          condition.notify_all();
+        }
+      }
+    }
+  };
+
+  if (count == 0) {
+    return;
+  }
+
+  /*
+     Helpers that are dequeued after every index has been taken return
+     without touching the function, so they may outlive this call.
+  */
+  const auto job = std::make_shared<Job>(function, count);
+  for (std::size_t i = 1; i < std::min(count, concurrency()); ++i) {
+    post([job] { job->run(); });
+  }
+  job->run();
+
+  std::unique_lock<std::mutex> lock(job->mutex);
+  job->condition.wait(lock, [&] { return job->finished == count; });
+  if (job->exception) {
+    std::rethrow_exception(job->exception);
+  }
+}
+}  // namespace simple_sensor_simulator
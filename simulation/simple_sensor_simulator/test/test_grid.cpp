@@ -0,0 +1,142 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <set>
+#include <simple_sensor_simulator/sensor_simulation/occupancy_grid/grid.hpp>
+#include <simple_sensor_simulator/sensor_simulation/primitives/box.hpp>
+#include <utility>
+
+using simple_sensor_simulator::Grid;
+
+namespace
+{
+/*
+   A 10 x 10 grid of 1 m cells centered on its origin, so that the world point
+   (x, y) seen from an identity origin falls in the cell of row floor(y + 5)
+   and column floor(x + 5), and the sensor sits on the corner of four cells.
+*/
+constexpr std::size_t size = 10;
+
+auto makePose(double x, double y)
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  return pose;
+}
+
+auto addBox(Grid & grid, double x, double y, double depth, double width)
+{
+  grid.addPrimitive(std::make_unique<simple_sensor_simulator::primitives::Box>(
+    depth, width, 1.0, makePose(x, y)));
+}
+
+using Cells = std::set<std::pair<std::size_t, std::size_t>>;
+
+auto cellsOf(const Grid & grid, std::int8_t value)
+{
+  Cells cells;
+  const auto & data = grid.getData();
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    if (data[i] == value) {
+      cells.emplace(i / grid.width, i % grid.width);
+    }
+  }
+  return cells;
+}
+}  // namespace
+
+TEST(Grid, occupiedCellsOfBox)
+{
+  Grid grid(1.0, size, size);
+  grid.updateOrigin(makePose(0.0, 0.0));
+  addBox(grid, 3.0, 0.0, 1.0, 1.0);
+  EXPECT_EQ(cellsOf(grid, grid.occupied_cost), (Cells{{4, 7}, {4, 8}, {5, 7}, {5, 8}}));
+}
+
+TEST(Grid, invisibleCellsBehindBox)
+{
+  Grid grid(1.0, size, size);
+  grid.updateOrigin(makePose(0.0, 0.0));
+  addBox(grid, 3.0, 0.0, 1.0, 1.0);
+  EXPECT_EQ(cellsOf(grid, grid.invisible_cost), (Cells{{4, 9}, {5, 9}}));
+  EXPECT_EQ(cellsOf(grid, 0).size(), size * size - 6);
+}
+
+TEST(Grid, invisibleCellsFollowOrigin)
+{
+  Grid grid(1.0, size, size);
+  grid.updateOrigin(makePose(0.0, 0.0));
+  addBox(grid, 0.0, 3.0, 1.0, 1.0);
+  grid.updateOrigin(makePose(10.0, 20.0));
+  EXPECT_EQ(cellsOf(grid, 0).size(), size * size);
+  addBox(grid, 10.0, 17.0, 0.8, 1.0);
+  EXPECT_EQ(cellsOf(grid, grid.occupied_cost), (Cells{{1, 4}, {1, 5}, {2, 4}, {2, 5}}));
+  EXPECT_EQ(cellsOf(grid, grid.invisible_cost), (Cells{{0, 4}, {0, 5}}));
+}
+
+TEST(Grid, boxContainingSensorHidesNothing)
+{
+  Grid grid(1.0, size, size);
+  grid.updateOrigin(makePose(0.0, 0.0));
+  addBox(grid, 0.0, 0.0, 1.0, 1.0);
+  EXPECT_EQ(cellsOf(grid, grid.occupied_cost), (Cells{{4, 4}, {4, 5}, {5, 4}, {5, 5}}));
+  EXPECT_TRUE(cellsOf(grid, grid.invisible_cost).empty());
+}
+
+TEST(Grid, boxOnCellBoundaries)
+{
+  Grid grid(1.0, size, size);
+  grid.updateOrigin(makePose(0.0, 0.0));
+  addBox(grid, 3.0, 0.0, 2.0, 2.0);
+  Cells occupied;
+  for (std::size_t row = 4; row <= 6; ++row) {
+    for (std::size_t column = 7; column <= 9; ++column) {
+      occupied.emplace(row, column);
+    }
+  }
+  EXPECT_EQ(cellsOf(grid, grid.occupied_cost), occupied);
+  for (const auto & [row, column] : cellsOf(grid, grid.invisible_cost)) {
+    EXPECT_GE(column, 7u);
+  }
+}
+
+TEST(Grid, boxAcrossGridEdge)
+{
+  Grid grid(1.0, size, size);
+  grid.updateOrigin(makePose(0.0, 0.0));
+  addBox(grid, 4.5, -5.0, 1.0, 1.0);
+  EXPECT_EQ(cellsOf(grid, grid.occupied_cost), (Cells{{0, 9}}));
+  EXPECT_TRUE(cellsOf(grid, grid.invisible_cost).empty());
+}
+
+TEST(Grid, boxOutsideGrid)
+{
+  Grid grid(1.0, size, size);
+  grid.updateOrigin(makePose(0.0, 0.0));
+  addBox(grid, 20.0, 0.0, 1.0, 1.0);
+  addBox(grid, 0.0, -20.0, 1.0, 1.0);
+  addBox(grid, -6.0, 0.0, 1.0, 1.0);
+  EXPECT_EQ(cellsOf(grid, 0).size(), size * size);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
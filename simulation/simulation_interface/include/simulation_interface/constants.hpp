@@ -19,10 +19,12 @@
 
 namespace simulation_interface
 {
-enum class TransportProtocol { TCP /*, UDP*/ };
+enum class TransportProtocol { TCP, IPC /*, UDP*/ };
 
 std::string enumToString(const TransportProtocol & protocol);
 
+TransportProtocol toTransportProtocol(const std::string & protocol);
+
 enum class HostName { LOCALHOST, ANY };
 
 std::string enumToString(const HostName & hostname);
@@ -43,6 +45,7 @@ const unsigned int attach_lidar_sensor = 5563;
 const unsigned int attach_detection_sensor = 5564;
 const unsigned int attach_occupancy_grid_sensor = 5565;
 const unsigned int update_traffic_lights = 5566;
+const unsigned int update_step = 5567;
 }  // namespace ports
 
 std::string getEndPoint(
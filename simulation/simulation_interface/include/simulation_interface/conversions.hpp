@@ -27,6 +27,7 @@
 #include <autoware_auto_vehicle_msgs/msg/gear_command.hpp>
 #include <builtin_interfaces/msg/duration.hpp>
 #include <builtin_interfaces/msg/time.hpp>
+#include <cstdint>
 #include <geometry_msgs/msg/accel.hpp>
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
@@ -57,19 +58,20 @@ namespace zeromq
 template <typename Proto>
 zmqpp::message toZMQ(const Proto & proto)
 {
+  const auto size = proto.ByteSizeLong();
+  auto buffer = new std::uint8_t[size];
+  proto.SerializeWithCachedSizesToArray(buffer);
   zmqpp::message msg;
-  std::string serialized_str = "";
-  proto.SerializeToString(&serialized_str);
-  msg << serialized_str;
+  msg.add_nocopy(
+    buffer, size, [](void * data, void *) { delete[] static_cast<std::uint8_t *>(data); });
   return msg;
 }
 
 template <typename Proto>
 Proto toProto(const zmqpp::message & msg)
 {
-  std::string serialized_str = msg.get(0);
   Proto proto;
-  proto.ParseFromString(serialized_str);
+  proto.ParseFromArray(msg.raw_data(0), msg.size(0));
   return proto;
 }
 }  // namespace zeromq
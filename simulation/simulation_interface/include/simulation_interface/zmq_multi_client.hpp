@@ -72,6 +72,9 @@ public:
   void call(
     const simulation_api_schema::UpdateTrafficLightsRequest & req,
     simulation_api_schema::UpdateTrafficLightsResponse & res);
+  void call(
+    const simulation_api_schema::UpdateStepRequest & req,
+    simulation_api_schema::UpdateStepResponse & res);
 
   const simulation_interface::TransportProtocol protocol;
   const std::string hostname;
@@ -91,6 +94,7 @@ private:
   zmqpp::socket socket_attach_detection_sensor_;
   zmqpp::socket socket_attach_occupancy_grid_sensor_;
   zmqpp::socket socket_update_traffic_lights_;
+  zmqpp::socket socket_update_step_;
 
   bool is_running = true;
 };
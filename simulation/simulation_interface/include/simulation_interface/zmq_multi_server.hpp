@@ -149,6 +149,7 @@ private:
     const simulation_api_schema::UpdateTrafficLightsRequest &,
     simulation_api_schema::UpdateTrafficLightsResponse &)>
     update_traffic_lights_func_;
+  zmqpp::socket update_step_sock_;
 };
 }  // namespace zeromq
 
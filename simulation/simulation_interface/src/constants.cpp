@@ -12,15 +12,61 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
 #include <scenario_simulator_exception/exception.hpp>
 #include <simulation_interface/constants.hpp>
 #include <string>
 
 namespace simulation_interface
 {
+namespace
+{
+// Returns whether the path is a directory, no symbolic link, owned by this user and private to it.
+bool isPrivateDirectory(const std::string & path)
+{
+  struct stat status;
+  return ::lstat(path.c_str(), &status) == 0 and S_ISDIR(status.st_mode) and
+         status.st_uid == ::geteuid() and (status.st_mode & (S_IRWXG | S_IRWXO)) == 0;
+}
+
+/**
+ * @brief Returns the directory holding the IPC sockets of this user.
+ * It is $XDG_RUNTIME_DIR if set, and otherwise a directory under /tmp named after the user id and
+ * created private to the user. The sockets are never placed in a directory others can write to.
+ */
+std::string getIpcDirectory()
+{
+  const auto runtime_directory = std::getenv("XDG_RUNTIME_DIR");
+  const auto directory = runtime_directory and *runtime_directory
+                           ? std::string(runtime_directory)
+                           : "/tmp/simulation_interface-" + std::to_string(::geteuid());
+  if (::mkdir(directory.c_str(), S_IRWXU) != 0 and errno != EEXIST) {
+    THROW_SIMULATION_ERROR("Failed to create directory ", directory, " for IPC sockets.");
+  }
+  if (not isPrivateDirectory(directory)) {
+    THROW_SIMULATION_ERROR(
+      "Directory ", directory, " for IPC sockets must be owned by this user and private to it.");
+  }
+  return directory;
+}
+
+// IPC endpoints are Unix domain sockets, so the hostname does not take part in them.
+std::string getIpcEndPoint(const unsigned int & port)
+{
+  return "ipc://" + getIpcDirectory() + "/simulation_interface_" + std::to_string(port);
+}
+}  // namespace
+
 std::string getEndPoint(
   const TransportProtocol & protocol, const HostName & hostname, const unsigned int & port)
 {
+  if (protocol == TransportProtocol::IPC) {
+    return getIpcEndPoint(port);
+  }
   return simulation_interface::enumToString(protocol) + "://" +
          simulation_interface::enumToString(hostname) + ":" + std::to_string(port);
 }
@@ -28,6 +74,9 @@ std::string getEndPoint(
 std::string getEndPoint(
   const TransportProtocol & protocol, const std::string & hostname, const unsigned int & port)
 {
+  if (protocol == TransportProtocol::IPC) {
+    return getIpcEndPoint(port);
+  }
   return simulation_interface::enumToString(protocol) + "://" + hostname + ":" +
          std::to_string(port);
 }
@@ -37,12 +86,24 @@ std::string enumToString(const TransportProtocol & protocol)
   switch (protocol) {
     case TransportProtocol::TCP:
       return "tcp";
+    case TransportProtocol::IPC:
+      return "ipc";
       /*
     case TransportProtocol::UDP:
       return "udp";              
       */
   }
-  THROW_SIMULATION_ERROR("Protocol should be TCP.");  // LCOV_EXCL_LINE
+  THROW_SIMULATION_ERROR("Protocol should be TCP or IPC.");  // LCOV_EXCL_LINE
+}
+
+TransportProtocol toTransportProtocol(const std::string & protocol)
+{
+  if (protocol == "tcp") {
+    return TransportProtocol::TCP;
+  } else if (protocol == "ipc") {
+    return TransportProtocol::IPC;
+  }
+  THROW_SIMULATION_ERROR("Unknown transport protocol ", protocol, ", it should be tcp or ipc.");
 }
 
 std::string enumToString(const HostName & hostname)
@@ -35,7 +35,8 @@ MultiClient::MultiClient(
   socket_attach_lidar_sensor_(context_, type_),
   socket_attach_detection_sensor_(context_, type_),
   socket_attach_occupancy_grid_sensor_(context_, type_),
-  socket_update_traffic_lights_(context_, type_)
+  socket_update_traffic_lights_(context_, type_),
+  socket_update_step_(context_, type_)
 {
   socket_initialize_.connect(
     simulation_interface::getEndPoint(protocol, hostname, simulation_interface::ports::initialize));
@@ -61,6 +62,8 @@ MultiClient::MultiClient(
     protocol, hostname, simulation_interface::ports::attach_occupancy_grid_sensor));
   socket_update_traffic_lights_.connect(simulation_interface::getEndPoint(
     protocol, hostname, simulation_interface::ports::update_traffic_lights));
+  socket_update_step_.connect(simulation_interface::getEndPoint(
+    protocol, hostname, simulation_interface::ports::update_step));
 
   rclcpp::on_shutdown([this] { is_running = false; });
 }
@@ -79,6 +82,7 @@ MultiClient::~MultiClient()
   socket_attach_detection_sensor_.close();
   socket_attach_occupancy_grid_sensor_.close();
   socket_update_traffic_lights_.close();
+  socket_update_step_.close();
 }
 
 void MultiClient::call(
@@ -227,4 +231,17 @@ void MultiClient::call(
     res = toProto<simulation_api_schema::UpdateTrafficLightsResponse>(buffer);
   }
 }
+
+void MultiClient::call(
+  const simulation_api_schema::UpdateStepRequest & req,
+  simulation_api_schema::UpdateStepResponse & res)
+{
+  if (is_running) {
+    zmqpp::message message = toZMQ(req);
+    socket_update_step_.send(message);
+    zmqpp::message buffer;
+    socket_update_step_.receive(buffer);
+    res = toProto<simulation_api_schema::UpdateStepResponse>(buffer);
+  }
+}
 }  // namespace zeromq
@@ -93,7 +93,8 @@ MultiServer::MultiServer(
   attach_occupancy_grid_sensor_sock_(context_, type_),
   attach_occupancy_grid_sensor_func_(attach_occupancy_sensor_func),
   update_traffic_lights_sock_(context_, type_),
-  update_traffic_lights_func_(update_traffic_lights_func)
+  update_traffic_lights_func_(update_traffic_lights_func),
+  update_step_sock_(context_, type_)
 {
   initialize_sock_.bind(
     simulation_interface::getEndPoint(protocol, hostname, simulation_interface::ports::initialize));
@@ -119,6 +120,8 @@ MultiServer::MultiServer(
     protocol, hostname, simulation_interface::ports::attach_occupancy_grid_sensor));
   update_traffic_lights_sock_.bind(simulation_interface::getEndPoint(
     protocol, hostname, simulation_interface::ports::update_traffic_lights));
+  update_step_sock_.bind(simulation_interface::getEndPoint(
+    protocol, hostname, simulation_interface::ports::update_step));
   poller_.add(initialize_sock_);
   poller_.add(update_frame_sock_);
   poller_.add(update_sensor_frame_sock_);
@@ -131,6 +134,7 @@ MultiServer::MultiServer(
   poller_.add(attach_detection_sensor_sock_);
   poller_.add(attach_occupancy_grid_sensor_sock_);
   poller_.add(update_traffic_lights_sock_);
+  poller_.add(update_step_sock_);
   thread_ = std::thread(&MultiServer::start_poll, this);
 }
 
@@ -245,6 +249,25 @@ void MultiServer::poll()
     auto msg = toZMQ(response);
     update_traffic_lights_sock_.send(msg);
   }
+  if (poller_.has_input(update_step_sock_)) {
+    zmqpp::message request;
+    update_step_sock_.receive(request);
+    const auto step = toProto<simulation_api_schema::UpdateStepRequest>(request);
+    simulation_api_schema::UpdateStepResponse response;
+    update_frame_func_(step.update_frame(), *response.mutable_update_frame());
+    if (response.update_frame().result().success()) {
+      update_entity_status_func_(
+        step.update_entity_status(), *response.mutable_update_entity_status());
+      if (step.has_update_traffic_lights()) {
+        update_traffic_lights_func_(
+          step.update_traffic_lights(), *response.mutable_update_traffic_lights());
+      }
+      update_sensor_frame_func_(
+        step.update_sensor_frame(), *response.mutable_update_sensor_frame());
+    }
+    auto msg = toZMQ(response);
+    update_step_sock_.send(msg);
+  }
 }
 void MultiServer::start_poll()
 {
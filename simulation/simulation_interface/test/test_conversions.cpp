@@ -14,6 +14,11 @@
 
 #include <geometry_msgs.pb.h>
 #include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <string>
 
 #include "expect_equal_macros.hpp"
 /**
@@ -547,6 +552,59 @@ TEST(Conversion, TrafficSignal)
   EXPECT_EQ(proto.lamp_states()[7].type(), LampState::DOWN);
 }
 
+TEST(Conversion, ZMQ)
+{
+  geometry_msgs::Pose proto;
+  proto.mutable_position()->set_x(1.0);
+  proto.mutable_position()->set_y(2.0);
+  proto.mutable_orientation()->set_w(1.0);
+  const auto restored = zeromq::toProto<geometry_msgs::Pose>(zeromq::toZMQ(proto));
+  EXPECT_DOUBLE_EQ(restored.position().x(), 1.0);
+  EXPECT_DOUBLE_EQ(restored.position().y(), 2.0);
+  EXPECT_DOUBLE_EQ(restored.position().z(), 0.0);
+  EXPECT_DOUBLE_EQ(restored.orientation().w(), 1.0);
+  const auto empty = zeromq::toProto<geometry_msgs::Pose>(zeromq::toZMQ(geometry_msgs::Pose()));
+  EXPECT_FALSE(empty.has_position());
+}
+
+TEST(Constants, EndPoint)
+{
+  using simulation_interface::getEndPoint;
+  using simulation_interface::HostName;
+  using simulation_interface::TransportProtocol;
+  EXPECT_EQ(getEndPoint(TransportProtocol::TCP, HostName::ANY, 5555), "tcp://*:5555");
+  EXPECT_EQ(getEndPoint(TransportProtocol::TCP, "localhost", 5555), "tcp://localhost:5555");
+  EXPECT_EQ(
+    getEndPoint(TransportProtocol::IPC, HostName::ANY, 5555),
+    getEndPoint(TransportProtocol::IPC, "localhost", 5555));
+  EXPECT_EQ(simulation_interface::toTransportProtocol("ipc"), TransportProtocol::IPC);
+  EXPECT_EQ(simulation_interface::toTransportProtocol("tcp"), TransportProtocol::TCP);
+  EXPECT_THROW(simulation_interface::toTransportProtocol("udp"), common::SimulationError);
+}
+
+TEST(Constants, IpcEndPointIsPrivate)
+{
+  using simulation_interface::getEndPoint;
+  using simulation_interface::HostName;
+  using simulation_interface::TransportProtocol;
+  const auto previous = std::getenv("XDG_RUNTIME_DIR");
+  const std::string previous_runtime_directory = previous ? previous : "";
+  std::string runtime_directory = "/tmp/simulation_interface_test-XXXXXX";
+  ASSERT_NE(::mkdtemp(&runtime_directory[0]), nullptr);
+  ::setenv("XDG_RUNTIME_DIR", runtime_directory.c_str(), 1);
+  EXPECT_EQ(
+    getEndPoint(TransportProtocol::IPC, HostName::ANY, 5555),
+    "ipc://" + runtime_directory + "/simulation_interface_5555");
+  ::chmod(runtime_directory.c_str(), S_IRWXU | S_IRWXG | S_IRWXO);
+  EXPECT_THROW(getEndPoint(TransportProtocol::IPC, HostName::ANY, 5555), common::SimulationError);
+  ::rmdir(runtime_directory.c_str());
+  if (previous) {
+    ::setenv("XDG_RUNTIME_DIR", previous_runtime_directory.c_str(), 1);
+  } else {
+    ::unsetenv("XDG_RUNTIME_DIR");
+  }
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -38,6 +38,7 @@
 #include <traffic_simulator/traffic/traffic_controller.hpp>
 #include <traffic_simulator/traffic_lights/traffic_light.hpp>
 #include <traffic_simulator_msgs/msg/driver_model.hpp>
+#include <unordered_map>
 #include <utility>
 
 namespace traffic_simulator
@@ -74,7 +75,7 @@ public:
       rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
     debug_marker_pub_(rclcpp::create_publisher<visualization_msgs::msg::MarkerArray>(
       node, "debug_marker", rclcpp::QoS(100), rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
-    zeromq_client_(simulation_interface::protocol, configuration.simulator_host)
+    zeromq_client_(configuration.transport_protocol, configuration.simulator_host)
   {
     metrics_manager_.setEntityManager(entity_manager_ptr_);
     setVerbose(configuration.verbose);
@@ -219,8 +220,13 @@ public:
 #undef FORWARD_TO_ENTITY_MANAGER
 
 private:
+  auto makeUpdateSensorFrameRequest() const -> simulation_api_schema::UpdateSensorFrameRequest;
   bool updateSensorFrame();
+  auto makeUpdateEntityStatusRequest() -> simulation_api_schema::UpdateEntityStatusRequest;
+  bool applyUpdateEntityStatusResponse(const simulation_api_schema::UpdateEntityStatusResponse &);
   bool updateEntityStatusInSim();
+  auto makeUpdateTrafficLightsRequest() const
+    -> boost::optional<simulation_api_schema::UpdateTrafficLightsRequest>;
   bool updateTrafficLightsInSim();
 
   const Configuration configuration;
@@ -238,6 +244,12 @@ private:
   traffic_simulator::SimulationClock clock_;
 
   zeromq::MultiClient zeromq_client_;
+
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> entity_status_in_sim_;
+
+  // the statuses of the pending UpdateEntityStatusRequest, kept once the simulator accepts them
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus>
+    entity_status_in_flight_;
 };
 }  // namespace traffic_simulator
 
@@ -20,8 +20,10 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/range/iterator_range.hpp>
+#include <cstdlib>
 #include <iomanip>
 #include <scenario_simulator_exception/exception.hpp>
+#include <simulation_interface/constants.hpp>
 #include <string>
 
 namespace traffic_simulator
@@ -42,6 +44,66 @@ struct Configuration
 
   std::string simulator_host = "localhost";
 
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  IPC connects to the simulator through Unix domain sockets instead of the
+   *  loopback TCP stack, which is cheaper when both run on the same host. The
+   *  simulator must be started with the same transport_protocol parameter,
+   *  and simulator_host is ignored.
+   *
+   * ------------------------------------------------------------------------ */
+  simulation_interface::TransportProtocol transport_protocol =
+    simulation_interface::TransportProtocol::TCP;
+
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  If true, UpdateEntityStatus only carries entities whose status changed
+   *  since the simulator last accepted it, ignoring the time and changes of
+   *  continuous values (pose, twist, accel, lanelet pose) smaller than
+   *  entity_status_delta_threshold. The simulator keeps the last status of the
+   *  others, so scenes with many parked or static NPCs send far fewer bytes
+   *  per frame.
+   *
+   * ------------------------------------------------------------------------ */
+  bool entity_status_delta_encoding = false;
+
+  double entity_status_delta_threshold = 1e-3;
+
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  If true, UpdateFrame, UpdateEntityStatus, UpdateTrafficLights and
+   *  UpdateSensorFrame are sent to the simulator as one UpdateStepRequest, so
+   *  a frame costs a single round trip. Enable this only for simulators which
+   *  serve update_step (e.g. simple_sensor_simulator); the request would block
+   *  forever on simulators which only serve the individual requests.
+   *
+   * ------------------------------------------------------------------------ */
+  bool combine_frame_requests = false;
+
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  If true, the behaviors of NPCs are updated on the OpenMP thread team
+   *  (bounded by OMP_NUM_THREADS). Each NPC only reads the statuses of the
+   *  other entities captured before the update, and the results are merged
+   *  in a fixed order afterwards. The ego entity is always updated on the
+   *  calling thread.
+   *
+   * ------------------------------------------------------------------------ */
+  bool parallel_npc_update = false;
+
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  If true, the lanelet map preprocessed at load (the map with resampled
+   *  centerlines and their lengths) is cached in map_cache_directory, keyed by
+   *  the SHA-256 digest of the map and the preprocessing parameters. The
+   *  directory is created private to the current user, and it is not used if
+   *  anyone else can write to it.
+   *
+   * ------------------------------------------------------------------------ */
+  bool cache_preprocessed_map = false;
+
+  Pathname map_cache_directory = defaultMapCacheDirectory();
+
   /* ---- NOTE -----------------------------------------------------------------
    *
    *  This setting comes from the argument of the same name (= `map_path`) in
@@ -137,6 +199,18 @@ struct Configuration
     }
   }
 
+  static auto defaultMapCacheDirectory() -> Pathname
+  {
+    if (const auto xdg_cache_home = std::getenv("XDG_CACHE_HOME");
+        xdg_cache_home and *xdg_cache_home) {
+      return Pathname(xdg_cache_home) / "scenario_simulator_v2" / "map_cache";
+    } else if (const auto home = std::getenv("HOME"); home and *home) {
+      return Pathname(home) / ".cache" / "scenario_simulator_v2" / "map_cache";
+    } else {
+      return "";
+    }
+  }
+
   auto lanelet2_map_path() const { return map_path / lanelet2_map_file; }
 
   auto pointcloud_map_path() const { return map_path / pointcloud_map_file; }
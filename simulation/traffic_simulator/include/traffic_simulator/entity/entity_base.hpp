@@ -23,6 +23,7 @@
 #include <queue>
 #include <string>
 #include <traffic_simulator/data_type/data_types.hpp>
+#include <traffic_simulator/entity/spatial_index.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/job/job_list.hpp>
 #include <traffic_simulator/traffic_lights/traffic_light_manager.hpp>
@@ -144,7 +145,8 @@ public:
   }
 
   /*   */ void setOtherStatus(
-    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & status);
+    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & status,
+    const SpatialIndex & spatial_index);
 
   virtual auto setStatus(const traffic_simulator_msgs::msg::EntityStatus & status) -> bool;
 
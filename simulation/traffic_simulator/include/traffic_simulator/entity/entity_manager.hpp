@@ -25,11 +25,13 @@
 #include <tf2_ros/transform_broadcaster.h>
 
 #include <boost/optional.hpp>
+#include <iostream>
 #include <memory>
 #include <rclcpp/node_interfaces/get_node_topics_interface.hpp>
 #include <rclcpp/node_interfaces/node_topics_interface.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
+#include <set>
 #include <stdexcept>
 #include <string>
 #include <traffic_simulator/api/configuration.hpp>
@@ -98,6 +100,10 @@ class EntityManager
 
   const std::shared_ptr<TrafficLightManagerBase> traffic_light_manager_ptr_;
 
+  SpatialIndex spatial_index_;
+
+  mutable boost::optional<std::set<std::pair<std::string, std::string>>> colliding_pairs_;
+
   using LaneletPose = traffic_simulator_msgs::msg::LaneletPose;
 
 public:
@@ -149,10 +155,17 @@ public:
       node, "lanelet/marker", LaneletMarkerQoS(),
       rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
     hdmap_utils_ptr_(std::make_shared<hdmap_utils::HdMapUtils>(
-      configuration.lanelet2_map_path(), getOrigin(*node))),
+      configuration.lanelet2_map_path(), getOrigin(*node),
+      configuration.cache_preprocessed_map ? configuration.map_cache_directory
+                                           : Configuration::Pathname())),
     markers_raw_(hdmap_utils_ptr_->generateMarker()),
     traffic_light_manager_ptr_(makeTrafficLightManager(hdmap_utils_ptr_, node))
   {
+    if (configuration.verbose) {
+      for (const auto & [phase, seconds] : hdmap_utils_ptr_->getLoadPhaseDurations()) {
+        std::cout << "elapsed " << seconds << " seconds to " << phase << "." << std::endl;
+      }
+    }
     updateHdmapMarker();
   }
 
@@ -170,6 +183,16 @@ public:
     return traffic_light_manager_ptr_->getTrafficLights();
   }
 
+  auto getChangedTrafficLightIdsForSimulator() const -> decltype(auto)
+  {
+    return traffic_light_manager_ptr_->getChangedTrafficLightIdsForSimulator();
+  }
+
+  auto acceptTrafficLightStatesBySimulator() const -> decltype(auto)
+  {
+    return traffic_light_manager_ptr_->acceptTrafficLightStatesBySimulator();
+  }
+
   template <typename... Ts>
   auto getTrafficRelationReferees(Ts &&... xs) const -> decltype(auto)
   {
@@ -254,6 +277,11 @@ public:
     const std::string & name,
     const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list);
 
+  void updateNpcLogicConcurrently(
+    const std::vector<std::string> & entity_names,
+    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list,
+    std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & all_status);
+
   void broadcastEntityTransform();
 
   void broadcastTransform(
@@ -261,6 +289,8 @@ public:
 
   bool checkCollision(const std::string & name0, const std::string & name1);
 
+  auto getCollidingPairs() const -> const std::set<std::pair<std::string, std::string>> &;
+
   bool despawnEntity(const std::string & name);
 
   bool entityExists(const std::string & name);
@@ -283,6 +313,9 @@ public:
 
   auto getEntityNames() const -> const std::vector<std::string>;
 
+  auto getEntityNamesWithin(const geometry_msgs::msg::Point &, const double radius) const
+    -> std::vector<std::string>;
+
   auto getEntityStatus(const std::string & name) const
     -> const boost::optional<traffic_simulator_msgs::msg::EntityStatus>;
 
@@ -353,6 +386,7 @@ public:
     const auto result =
       entities_.emplace(name, std::make_unique<Entity>(name, std::forward<decltype(xs)>(xs)...));
     if (result.second) {
+      colliding_pairs_ = boost::none;
       result.first->second->setHdMapUtils(hdmap_utils_ptr_);
       result.first->second->setTrafficLightManager(traffic_light_manager_ptr_);
       return result.second;
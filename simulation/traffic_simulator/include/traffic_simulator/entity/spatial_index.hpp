@@ -0,0 +1,92 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__ENTITY__SPATIAL_INDEX_HPP_
+#define TRAFFIC_SIMULATOR__ENTITY__SPATIAL_INDEX_HPP_
+
+#include <cmath>
+#include <cstdint>
+#include <geometry_msgs/msg/point.hpp>
+#include <string>
+#include <traffic_simulator_msgs/msg/entity_status.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace entity
+{
+/**
+ * @brief Uniform grid over the x-y positions of entities, rebuilt by EntityManager whenever the
+ * statuses of all entities are gathered, so that "entities within radius" queries only visit the
+ * entities in the neighbouring cells.
+ */
+class SpatialIndex
+{
+public:
+  explicit SpatialIndex(double cell_size = 30.0);
+
+  void build(
+    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & statuses);
+
+  /**
+   * @brief Calls function(name, position) for every entity closer than radius to the point.
+   */
+  template <typename Function>
+  void forEachWithin(
+    const geometry_msgs::msg::Point & point, double radius, Function && function) const
+  {
+    const auto reach = static_cast<std::int64_t>(std::ceil(radius / cell_size_));
+    const auto x = getCellIndex(point.x);
+    const auto y = getCellIndex(point.y);
+    for (auto cell_x = x - reach; cell_x <= x + reach; ++cell_x) {
+      for (auto cell_y = y - reach; cell_y <= y + reach; ++cell_y) {
+        const auto cell = cells_.find(getCellKey(cell_x, cell_y));
+        if (cell == cells_.end()) {
+          continue;
+        }
+        for (const auto index : cell->second) {
+          const auto & entry = entries_[index];
+          if (
+            std::hypot(
+              entry.position.x - point.x, entry.position.y - point.y,
+              entry.position.z - point.z) < radius) {
+            function(entry.name, entry.position);
+          }
+        }
+      }
+    }
+  }
+
+  std::vector<std::string> getEntityNamesWithin(
+    const geometry_msgs::msg::Point & point, double radius) const;
+
+private:
+  std::int64_t getCellIndex(double value) const;
+  static std::int64_t getCellKey(std::int64_t x, std::int64_t y);
+
+  struct Entry
+  {
+    std::string name;
+    geometry_msgs::msg::Point position;
+  };
+
+  double cell_size_;
+  std::vector<Entry> entries_;
+  std::unordered_map<std::int64_t, std::vector<std::size_t>> cells_;
+};
+}  // namespace entity
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__ENTITY__SPATIAL_INDEX_HPP_
@@ -18,6 +18,7 @@
 #include <boost/optional.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <geometry_msgs/msg/point.hpp>
+#include <memory>
 #include <mutex>
 #include <scenario_simulator_exception/exception.hpp>
 #include <unordered_map>
@@ -28,26 +29,14 @@ namespace hdmap_utils
 class RouteCache
 {
 public:
-  bool exists(std::int64_t from, std::int64_t to)
+  boost::optional<std::vector<std::int64_t>> getRoute(std::int64_t from, std::int64_t to) const
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    std::pair<std::int64_t, std::int64_t> key;
-    key.first = from;
-    key.second = to;
-    if (data_.find(key) == data_.end()) {
-      return false;
+    const auto iter = data_.find({from, to});
+    if (iter == data_.end()) {
+      return boost::none;
     }
-    return true;
-  }
-  std::vector<std::int64_t> getRoute(std::int64_t from, std::int64_t to)
-  {
-    if (!exists(from, to)) {
-      THROW_SIMULATION_ERROR(
-        "route from : ", from, " to : ", to, " does not exists on route cache.");
-    }
-    std::lock_guard<std::mutex> lock(mutex_);
-    const auto ret = data_.at({from, to});
-    return ret;
+    return iter->second;
   }
   void appendData(std::int64_t from, std::int64_t to, const std::vector<std::int64_t> & route)
   {
@@ -57,77 +46,66 @@ public:
 
 private:
   std::unordered_map<std::pair<std::int64_t, std::int64_t>, std::vector<std::int64_t>> data_;
-  std::mutex mutex_;
+  mutable std::mutex mutex_;
 };
 
-class CenterPointsCache
+/**
+ * @brief Centerlines, centerline splines and lengths of every lanelet in the map.
+ * The table is filled once while the map is loaded and never modified afterwards,
+ * so lookups take no lock and return references into the table.
+ */
+class CenterlineCache
 {
 public:
-  bool exists(std::int64_t lanelet_id)
+  bool exists(std::int64_t lanelet_id) const { return index_.find(lanelet_id) != index_.end(); }
+  const std::vector<geometry_msgs::msg::Point> & getCenterPoints(std::int64_t lanelet_id) const
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (data_.find(lanelet_id) == data_.end()) {
-      return false;
-    }
-    return true;
+    return center_points_[index(lanelet_id)];
   }
-  std::vector<geometry_msgs::msg::Point> getCenterPoints(std::int64_t lanelet_id)
+  const std::shared_ptr<math::geometry::CatmullRomSpline> & getCenterPointsSpline(
+    std::int64_t lanelet_id) const
   {
-    if (!exists(lanelet_id)) {
-      THROW_SIMULATION_ERROR("center point of : ", lanelet_id, " does not exists on route cache.");
+    const auto & spline = splines_[index(lanelet_id)];
+    if (!spline) {
+      THROW_SIMULATION_ERROR(
+        "center points of lanelet : ", lanelet_id, " are too few to make a spline.");
     }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return data_.at(lanelet_id);
+    return spline;
   }
-  std::shared_ptr<math::geometry::CatmullRomSpline> getCenterPointsSpline(std::int64_t lanelet_id)
+  double getLength(std::int64_t lanelet_id) const { return lengths_[index(lanelet_id)]; }
+  void appendData(
+    std::int64_t lanelet_id, const std::vector<geometry_msgs::msg::Point> & center_points,
+    double length)
   {
-    if (!exists(lanelet_id)) {
-      THROW_SIMULATION_ERROR("center point of : ", lanelet_id, " does not exists on route cache.");
-    }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return splines_[lanelet_id];
+    appendData(
+      lanelet_id, center_points, length,
+      center_points.size() >= 3
+        ? std::make_shared<math::geometry::CatmullRomSpline>(center_points)
+        : nullptr);
   }
-  void appendData(std::int64_t lanelet_id, const std::vector<geometry_msgs::msg::Point> & route)
+  void appendData(
+    std::int64_t lanelet_id, const std::vector<geometry_msgs::msg::Point> & center_points,
+    double length, const std::shared_ptr<math::geometry::CatmullRomSpline> & spline)
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    data_[lanelet_id] = route;
-    splines_[lanelet_id] = std::make_shared<math::geometry::CatmullRomSpline>(route);
+    index_.emplace(lanelet_id, center_points_.size());
+    center_points_.push_back(center_points);
+    splines_.push_back(spline);
+    lengths_.push_back(length);
   }
 
 private:
-  std::unordered_map<std::int64_t, std::vector<geometry_msgs::msg::Point>> data_;
-  std::unordered_map<std::int64_t, std::shared_ptr<math::geometry::CatmullRomSpline>> splines_;
-  std::mutex mutex_;
-};
-
-class LaneletLengthCache
-{
-public:
-  bool exists(std::int64_t lanelet_id)
+  std::size_t index(std::int64_t lanelet_id) const
   {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (data_.find(lanelet_id) == data_.end()) {
-      return false;
+    const auto iter = index_.find(lanelet_id);
+    if (iter == index_.end()) {
+      THROW_SIMULATION_ERROR("lanelet : ", lanelet_id, " does not exists on centerline cache.");
     }
-    return true;
+    return iter->second;
   }
-  double getLength(std::int64_t lanelet_id)
-  {
-    if (!exists(lanelet_id)) {
-      THROW_SIMULATION_ERROR("length of : ", lanelet_id, " does not exists on route cache.");
-    }
-    std::lock_guard<std::mutex> lock(mutex_);
-    return data_[lanelet_id];
-  }
-  void appendData(std::int64_t lanelet_id, double length)
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    data_[lanelet_id] = length;
-  }
-
-private:
-  std::unordered_map<std::int64_t, double> data_;
-  std::mutex mutex_;
+  std::unordered_map<std::int64_t, std::size_t> index_;
+  std::vector<std::vector<geometry_msgs::msg::Point>> center_points_;
+  std::vector<std::shared_ptr<math::geometry::CatmullRomSpline>> splines_;
+  std::vector<double> lengths_;
 };
 }  // namespace hdmap_utils
 
@@ -50,6 +50,8 @@
 #include <string>
 #include <traffic_simulator/data_type/data_types.hpp>
 #include <traffic_simulator/hdmap_utils/cache.hpp>
+#include <traffic_simulator/hdmap_utils/lanelet_graph.hpp>
+#include <traffic_simulator/hdmap_utils/longitudinal_distance_index.hpp>
 #include <traffic_simulator_msgs/msg/bounding_box.hpp>
 #include <traffic_simulator_msgs/msg/entity_status.hpp>
 #include <unordered_map>
@@ -64,7 +66,21 @@ enum class LaneletType { LANE, CROSSWALK };
 class HdMapUtils
 {
 public:
-  explicit HdMapUtils(const boost::filesystem::path &, const geographic_msgs::msg::GeoPoint &);
+  /**
+   * @param map_cache_directory If not empty, the preprocessed map is cached in this directory. It
+   * is only used when it is owned by the current user and writable by nobody else.
+   * @param longitudinal_distance_horizon Longitudinal distances up to this length are looked up
+   * from a table searched once per source lanelet. Longer ones are computed along a route.
+   */
+  explicit HdMapUtils(
+    const boost::filesystem::path &, const geographic_msgs::msg::GeoPoint &,
+    const boost::filesystem::path & map_cache_directory = "",
+    double longitudinal_distance_horizon = 500.0);
+
+  /**
+   * @brief Wall time in seconds spent in each phase of loading the map, in the order they ended.
+   */
+  auto getLoadPhaseDurations() const -> const std::vector<std::pair<std::string, double>> &;
 
   const autoware_auto_mapping_msgs::msg::HADMapBin toMapBin();
   void insertMarkerArray(
@@ -91,10 +107,11 @@ public:
   geometry_msgs::msg::PoseStamped toMapPose(std::int64_t lanelet_id, double s, double offset);
   double getHeight(const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose);
   const std::vector<std::int64_t> getLaneletIds();
-  std::vector<std::int64_t> getNextLaneletIds(std::int64_t lanelet_id, std::string turn_direction);
+  std::vector<std::int64_t> getNextLaneletIds(
+    std::int64_t lanelet_id, std::string turn_direction) const;
   std::vector<std::int64_t> getNextLaneletIds(std::int64_t lanelet_id) const;
   std::vector<std::int64_t> getPreviousLaneletIds(
-    std::int64_t lanelet_id, std::string turn_direction);
+    std::int64_t lanelet_id, std::string turn_direction) const;
   std::vector<std::int64_t> getPreviousLaneletIds(std::int64_t lanelet_id) const;
   boost::optional<int64_t> getLaneChangeableLaneletId(
     std::int64_t lanelet_id, traffic_simulator::lane_change::Direction direction);
@@ -106,7 +123,7 @@ public:
   boost::optional<double> getDistanceToStopLine(
     const std::vector<std::int64_t> & route_lanelets,
     const math::geometry::CatmullRomSplineInterface & spline);
-  double getLaneletLength(std::int64_t lanelet_id);
+  double getLaneletLength(std::int64_t lanelet_id) const;
   bool isInLanelet(std::int64_t lanelet_id, double s);
   boost::optional<double> getLongitudinalDistance(
     traffic_simulator_msgs::msg::LaneletPose from, traffic_simulator_msgs::msg::LaneletPose to);
@@ -120,9 +137,11 @@ public:
     std::int64_t lanelet_id, std::vector<std::int64_t> candidate_lanelet_ids, double distance = 100,
     bool include_self = true);
   std::vector<std::int64_t> getPreviousLanelets(std::int64_t lanelet_id, double distance = 100);
-  std::vector<geometry_msgs::msg::Point> getCenterPoints(std::int64_t lanelet_id);
-  std::vector<geometry_msgs::msg::Point> getCenterPoints(std::vector<std::int64_t> lanelet_ids);
-  std::shared_ptr<math::geometry::CatmullRomSpline> getCenterPointsSpline(std::int64_t lanelet_id);
+  const std::vector<geometry_msgs::msg::Point> & getCenterPoints(std::int64_t lanelet_id) const;
+  std::vector<geometry_msgs::msg::Point> getCenterPoints(
+    std::vector<std::int64_t> lanelet_ids) const;
+  const std::shared_ptr<math::geometry::CatmullRomSpline> & getCenterPointsSpline(
+    std::int64_t lanelet_id) const;
   std::vector<geometry_msgs::msg::Point> clipTrajectoryFromLaneletIds(
     std::int64_t lanelet_id, double s, std::vector<std::int64_t> lanelet_ids,
     double forward_distance = 20);
@@ -195,9 +214,15 @@ private:
     const traffic_simulator_msgs::msg::LaneletPose & to_pose,
     const traffic_simulator::lane_change::TrajectoryShape trajectory_shape,
     double tangent_vector_size = 100);
+  std::vector<geometry_msgs::msg::Point> toCenterPoints(
+    const lanelet::ConstLanelet & lanelet) const;
+  bool loadMapCache(const boost::filesystem::path & cache_path);
+  void saveMapCache(const boost::filesystem::path & cache_path) const;
   RouteCache route_cache_;
-  CenterPointsCache center_points_cache_;
-  LaneletLengthCache lanelet_length_cache_;
+  CenterlineCache centerline_cache_;
+  LaneletGraph lanelet_graph_;
+  std::unique_ptr<const LongitudinalDistanceIndex> longitudinal_distance_index_;
+  std::vector<std::pair<std::string, double>> load_phase_durations_;
   std::vector<lanelet::AutowareTrafficLightConstPtr> getTrafficLights(
     const std::int64_t traffic_light_id) const;
   std::vector<std::pair<double, lanelet::Lanelet>> excludeSubtypeLanelets(
@@ -221,6 +246,8 @@ private:
   void overwriteLaneletsCenterline();
   lanelet::LineString3d generateFineCenterline(
     const lanelet::ConstLanelet & lanelet_obj, const double resolution);
+  std::vector<lanelet::BasicPoint3d> generateFineCenterPoints(
+    const lanelet::ConstLanelet & lanelet_obj, const double resolution);
   std::vector<lanelet::BasicPoint3d> resamplePoints(
     const lanelet::ConstLineString3d & line_string, const int32_t num_segments);
   std::pair<size_t, size_t> findNearestIndexPair(
@@ -0,0 +1,90 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__HDMAP_UTILS__LANELET_GRAPH_HPP_
+#define TRAFFIC_SIMULATOR__HDMAP_UTILS__LANELET_GRAPH_HPP_
+
+#include <lanelet2_core/LaneletMap.h>
+#include <lanelet2_core/primitives/BasicRegulatoryElements.h>
+#include <lanelet2_routing/RoutingGraph.h>
+
+#include <boost/optional.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace hdmap_utils
+{
+/**
+ * @brief Connectivity of every lanelet in the map, built once at map load.
+ * Lanelet ids are mapped to dense indices, and the neighbours of each lanelet are stored
+ * contiguously (compressed sparse row), so queries neither allocate nor walk the routing graph.
+ */
+class LaneletGraph
+{
+public:
+  using Ids = boost::iterator_range<std::vector<std::int64_t>::const_iterator>;
+
+  LaneletGraph() = default;
+  explicit LaneletGraph(
+    const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+    const lanelet::routing::RoutingGraphConstPtr & vehicle_routing_graph_ptr);
+
+  bool contains(std::int64_t lanelet_id) const;
+  std::size_t getIndex(std::int64_t lanelet_id) const;
+  const std::vector<std::int64_t> & getIds() const;
+  std::size_t size() const;
+
+  Ids getNext(std::int64_t lanelet_id) const;
+  Ids getPrevious(std::int64_t lanelet_id) const;
+  Ids getConflicting(std::int64_t lanelet_id) const;
+  Ids getRightOfWay(std::int64_t lanelet_id) const;
+  const boost::optional<std::int64_t> & getLeft(std::int64_t lanelet_id) const;
+  const boost::optional<std::int64_t> & getRight(std::int64_t lanelet_id) const;
+  const std::string & getTurnDirection(std::int64_t lanelet_id) const;
+
+private:
+  struct Adjacency
+  {
+    std::vector<std::size_t> offsets = {0};
+    std::vector<std::int64_t> ids;
+    template <typename Lanelets>
+    void append(const Lanelets & lanelets)
+    {
+      for (const auto & lanelet : lanelets) {
+        ids.push_back(lanelet.id());
+      }
+      offsets.push_back(ids.size());
+    }
+    Ids operator[](std::size_t index) const
+    {
+      return {ids.begin() + offsets[index], ids.begin() + offsets[index + 1]};
+    }
+  };
+
+  std::unordered_map<std::int64_t, std::size_t> index_;
+  std::vector<std::int64_t> ids_;
+  Adjacency next_;
+  Adjacency previous_;
+  Adjacency conflicting_;
+  Adjacency right_of_way_;
+  std::vector<boost::optional<std::int64_t>> left_;
+  std::vector<boost::optional<std::int64_t>> right_;
+  std::vector<std::string> turn_directions_;
+};
+}  // namespace hdmap_utils
+
+#endif  // TRAFFIC_SIMULATOR__HDMAP_UTILS__LANELET_GRAPH_HPP_
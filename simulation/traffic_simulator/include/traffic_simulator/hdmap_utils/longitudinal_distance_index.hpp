@@ -0,0 +1,66 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__HDMAP_UTILS__LONGITUDINAL_DISTANCE_INDEX_HPP_
+#define TRAFFIC_SIMULATOR__HDMAP_UTILS__LONGITUDINAL_DISTANCE_INDEX_HPP_
+
+#include <boost/optional.hpp>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <traffic_simulator/hdmap_utils/cache.hpp>
+#include <traffic_simulator/hdmap_utils/lanelet_graph.hpp>
+#include <utility>
+#include <vector>
+
+namespace hdmap_utils
+{
+/**
+ * @brief Shortest distances along the lane from a lanelet to every lanelet reachable within a
+ * horizon. The distances from a lanelet are searched the first time they are asked for and kept
+ * for later lookups, stored contiguously and sorted by lanelet id. Lookups are thread-safe.
+ */
+class LongitudinalDistanceIndex
+{
+public:
+  /**
+   * @note The index refers to lanelet_graph, which must outlive it.
+   */
+  explicit LongitudinalDistanceIndex(
+    const LaneletGraph & lanelet_graph, const CenterlineCache & centerline_cache,
+    double horizon);
+
+  /**
+   * @brief Distance from the start of the lanelet at from_index (dense index of LaneletGraph)
+   * to the start of to_lanelet_id.
+   * @return boost::none if to_lanelet_id is not reachable within the horizon.
+   */
+  boost::optional<double> getOffset(std::size_t from_index, std::int64_t to_lanelet_id) const;
+  double getHorizon() const;
+
+private:
+  using Row = std::vector<std::pair<std::int64_t, double>>;
+
+  const Row & getRow(std::size_t from_index) const;
+  Row search(std::size_t from_index) const;
+
+  const LaneletGraph & lanelet_graph_;
+  const double horizon_;
+  std::vector<double> lengths_;
+  mutable std::vector<std::unique_ptr<const Row>> rows_;
+  mutable std::mutex mutex_;
+};
+}  // namespace hdmap_utils
+
+#endif  // TRAFFIC_SIMULATOR__HDMAP_UTILS__LONGITUDINAL_DISTANCE_INDEX_HPP_
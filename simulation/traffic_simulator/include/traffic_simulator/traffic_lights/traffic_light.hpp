@@ -311,6 +311,12 @@ struct TrafficLight
 
   auto empty() const { return bulbs.empty(); }
 
+  /**
+   * @brief Hashes of the bulbs in ascending order. Two states of a traffic light look the same
+   * exactly when their hashes are equal.
+   */
+  auto hashes() const -> std::vector<Bulb::Hash>;
+
   auto set(const std::string & states) -> void;
 
   explicit operator autoware_auto_perception_msgs::msg::TrafficSignal() const;
@@ -18,6 +18,7 @@
 #include <autoware_auto_perception_msgs/msg/traffic_signal_array.hpp>
 #include <iomanip>
 #include <memory>
+#include <mutex>
 #include <rclcpp/rclcpp.hpp>
 #include <stdexcept>  // std::out_of_range
 #include <string>
@@ -36,8 +37,16 @@ class TrafficLightManagerBase
 protected:
   using LaneletID = std::int64_t;
 
+  using TrafficLightStates = std::unordered_map<LaneletID, std::vector<TrafficLight::Bulb::Hash>>;
+
   std::unordered_map<LaneletID, TrafficLight> traffic_lights_;
 
+  TrafficLightStates published_states_;
+
+  TrafficLightStates sent_states_;
+
+  std::mutex traffic_lights_mutex_;
+
   const rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr marker_pub_;
 
   const rclcpp::Clock::SharedPtr clock_ptr_;
@@ -58,15 +67,28 @@ protected:
   {
   }
 
-  auto deleteAllMarkers() const -> void;
+  auto drawMarkers(const std::vector<LaneletID> & changed_ids) const -> void;
+
+  /**
+   * @brief Returns the IDs of the traffic lights whose state differs from the one recorded in
+   * `states`.
+   */
+  auto getChangedTrafficLightIds(const TrafficLightStates & states) const
+    -> std::vector<LaneletID>;
 
-  auto drawMarkers() const -> void;
+  /**
+   * @brief Returns the IDs of the traffic lights whose state differs from the one recorded in
+   * `states`, and records their current state there.
+   */
+  auto takeChangedTrafficLightIds(TrafficLightStates & states) const -> std::vector<LaneletID>;
 
-  virtual auto publishTrafficLightStateArray() const -> void = 0;
+  virtual auto publishTrafficLightStateArray(const std::vector<LaneletID> & changed_ids)
+    -> void = 0;
 
 public:
   auto getTrafficLight(const LaneletID lanelet_id) -> auto &
   {
+    std::lock_guard<std::mutex> lock(traffic_lights_mutex_);
     if (auto iter = traffic_lights_.find(lanelet_id); iter != std::end(traffic_lights_)) {
       return iter->second;
     } else {
@@ -101,7 +123,22 @@ public:
     return refers;
   }
 
-  auto hasAnyLightChanged() -> bool;
+  auto hasAnyLightChanged() const -> bool;
+
+  /**
+   * @brief Returns the IDs of the traffic lights changed since the simulator last accepted their
+   * states, so that only they are sent to the simulator.
+   */
+  auto getChangedTrafficLightIdsForSimulator() const -> std::vector<LaneletID>
+  {
+    return getChangedTrafficLightIds(sent_states_);
+  }
+
+  /**
+   * @brief Records the current states of all traffic lights as accepted by the simulator. Call it
+   * only once the simulator succeeded, so that rejected changes are sent again.
+   */
+  auto acceptTrafficLightStatesBySimulator() -> void { takeChangedTrafficLightIds(sent_states_); }
 
   auto update(const double) -> void;
 };
@@ -111,6 +148,10 @@ class TrafficLightManager : public TrafficLightManagerBase
 {
   const typename rclcpp::Publisher<Message>::SharedPtr traffic_light_state_array_publisher_;
 
+  Message traffic_light_state_array_;
+
+  std::unordered_map<LaneletID, std::size_t> signal_indices_;
+
 public:
   template <typename Node>
   explicit TrafficLightManager(
@@ -125,13 +166,13 @@ public:
 private:
   static auto name() -> const char *;
 
-  auto publishTrafficLightStateArray() const -> void override;
+  auto publishTrafficLightStateArray(const std::vector<LaneletID> & changed_ids)
+    -> void override;
 };
 
 template <>
-auto TrafficLightManager<
-  autoware_auto_perception_msgs::msg::TrafficSignalArray>::publishTrafficLightStateArray() const
-  -> void;
+auto TrafficLightManager<autoware_auto_perception_msgs::msg::TrafficSignalArray>::
+  publishTrafficLightStateArray(const std::vector<LaneletID> & changed_ids) -> void;
 
 template <>
 auto TrafficLightManager<autoware_auto_perception_msgs::msg::TrafficSignalArray>::name() -> const
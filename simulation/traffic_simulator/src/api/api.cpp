@@ -14,6 +14,7 @@
 
 #include <tf2/LinearMath/Quaternion.h>
 
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
@@ -22,9 +23,41 @@
 #include <stdexcept>
 #include <string>
 #include <traffic_simulator/api/api.hpp>
+#include <utility>
 
 namespace traffic_simulator
 {
+namespace
+{
+auto changed(
+  const traffic_simulator_msgs::msg::EntityStatus & from,
+  const traffic_simulator_msgs::msg::EntityStatus & to, double threshold) -> bool
+{
+  const auto exceeds = [threshold](double a, double b) { return threshold < std::abs(a - b); };
+  const auto vector_changed = [&](const auto & a, const auto & b) {
+    return exceeds(a.x, b.x) or exceeds(a.y, b.y) or exceeds(a.z, b.z);
+  };
+  const auto quaternion_changed = [&](const auto & a, const auto & b) {
+    return vector_changed(a, b) or exceeds(a.w, b.w);
+  };
+  // every member but time, which the simulator takes from UpdateFrame
+  return from.type != to.type or from.subtype != to.subtype or from.name != to.name or
+         from.bounding_box != to.bounding_box or
+         from.action_status.current_action != to.action_status.current_action or
+         vector_changed(from.action_status.twist.linear, to.action_status.twist.linear) or
+         vector_changed(from.action_status.twist.angular, to.action_status.twist.angular) or
+         vector_changed(from.action_status.accel.linear, to.action_status.accel.linear) or
+         vector_changed(from.action_status.accel.angular, to.action_status.accel.angular) or
+         vector_changed(from.pose.position, to.pose.position) or
+         quaternion_changed(from.pose.orientation, to.pose.orientation) or
+         from.lanelet_pose_valid != to.lanelet_pose_valid or
+         from.lanelet_pose.lanelet_id != to.lanelet_pose.lanelet_id or
+         exceeds(from.lanelet_pose.s, to.lanelet_pose.s) or
+         exceeds(from.lanelet_pose.offset, to.lanelet_pose.offset) or
+         vector_changed(from.lanelet_pose.rpy, to.lanelet_pose.rpy);
+}
+}  // namespace
+
 metrics::MetricLifecycle API::getMetricLifecycle(const std::string & name)
 {
   return metrics_manager_.getLifecycle(name);
@@ -49,6 +82,7 @@ bool API::despawn(const std::string & name)
     simulation_api_schema::DespawnEntityResponse res;
     req.set_name(name);
     zeromq_client_.call(req, res);
+    entity_status_in_sim_.erase(name);
     return res.result().success();
   }
   return true;
@@ -272,6 +306,7 @@ bool API::setEntityStatus(
 bool API::initialize(double realtime_factor, double step_time)
 {
   clock_.initialize(-1 * configuration.initialize_duration, step_time);
+  entity_status_in_sim_.clear();
 
   if (configuration.standalone_mode) {
     return true;
@@ -338,39 +373,57 @@ bool API::attachLidarSensor(const std::string & entity_name, const helper::Lidar
     lidar_type, entity_name, getParameter<std::string>("architecture_type", "awf/universe")));
 }
 
+auto API::makeUpdateSensorFrameRequest() const -> simulation_api_schema::UpdateSensorFrameRequest
+{
+  simulation_api_schema::UpdateSensorFrameRequest req;
+  req.set_current_time(clock_.getCurrentSimulationTime());
+  simulation_interface::toProto(
+    clock_.getCurrentRosTimeAsMsg().clock, *req.mutable_current_ros_time());
+  return req;
+}
+
 bool API::updateSensorFrame()
 {
   if (configuration.standalone_mode) {
     return true;
   } else {
-    simulation_api_schema::UpdateSensorFrameRequest req;
-    req.set_current_time(clock_.getCurrentSimulationTime());
-    simulation_interface::toProto(
-      clock_.getCurrentRosTimeAsMsg().clock, *req.mutable_current_ros_time());
     simulation_api_schema::UpdateSensorFrameResponse res;
-    zeromq_client_.call(req, res);
+    zeromq_client_.call(makeUpdateSensorFrameRequest(), res);
     return res.result().success();
   }
 }
 
-bool API::updateTrafficLightsInSim()
+auto API::makeUpdateTrafficLightsRequest() const
+  -> boost::optional<simulation_api_schema::UpdateTrafficLightsRequest>
 {
-  simulation_api_schema::UpdateTrafficLightsRequest req;
-  simulation_api_schema::UpdateTrafficLightsResponse res;
-  if (entity_manager_ptr_->trafficLightsChanged()) {
-    for (const auto & [id, traffic_light] : entity_manager_ptr_->getTrafficLights()) {
-      simulation_api_schema::TrafficLightState state;
+  if (const auto changed_ids = entity_manager_ptr_->getChangedTrafficLightIdsForSimulator();
+      not changed_ids.empty()) {
+    simulation_api_schema::UpdateTrafficLightsRequest req;
+    for (const auto id : changed_ids) {
       simulation_interface::toProto(
-        static_cast<autoware_auto_perception_msgs::msg::TrafficSignal>(traffic_light), state);
-      *req.add_states() = state;
+        static_cast<autoware_auto_perception_msgs::msg::TrafficSignal>(
+          entity_manager_ptr_->getTrafficLights().at(id)),
+        *req.add_states());
     }
-    zeromq_client_.call(req, res);
+    return req;
   }
-  // TODO handle response
-  return res.result().success();
+  return boost::none;
 }
 
-bool API::updateEntityStatusInSim()
+bool API::updateTrafficLightsInSim()
+{
+  if (const auto req = makeUpdateTrafficLightsRequest()) {
+    simulation_api_schema::UpdateTrafficLightsResponse res;
+    zeromq_client_.call(req.get(), res);
+    if (res.result().success()) {
+      entity_manager_ptr_->acceptTrafficLightStatesBySimulator();
+    }
+    return res.result().success();
+  }
+  return true;
+}
+
+auto API::makeUpdateEntityStatusRequest() -> simulation_api_schema::UpdateEntityStatusRequest
 {
   simulation_api_schema::UpdateEntityStatusRequest req;
   if (entity_manager_ptr_->getNumberOfEgo() != 0) {
@@ -387,18 +440,36 @@ bool API::updateEntityStatusInSim()
       req.set_ego_entity_status_before_update_is_empty(true);
     }
   }
+  req.set_is_delta(configuration.entity_status_delta_encoding);
+  entity_status_in_flight_.clear();
   const auto names = entity_manager_ptr_->getEntityNames();
   for (const auto & name : names) {
     auto status = entity_manager_ptr_->getEntityStatus(name);
     if (status) {
-      traffic_simulator_msgs::EntityStatus proto;
       status.get().name = name;
-      simulation_interface::toProto(status.get(), proto);
-      *req.add_status() = proto;
+      if (configuration.entity_status_delta_encoding) {
+        if (const auto sent = entity_status_in_sim_.find(name);
+            sent != entity_status_in_sim_.end() and
+            not changed(sent->second, status.get(), configuration.entity_status_delta_threshold)) {
+          continue;
+        }
+        entity_status_in_flight_[name] = status.get();
+      }
+      simulation_interface::toProto(status.get(), *req.add_status());
     }
   }
-  simulation_api_schema::UpdateEntityStatusResponse res;
-  zeromq_client_.call(req, res);
+  return req;
+}
+
+bool API::applyUpdateEntityStatusResponse(
+  const simulation_api_schema::UpdateEntityStatusResponse & res)
+{
+  if (res.result().success()) {
+    for (auto && [name, status] : entity_status_in_flight_) {
+      entity_status_in_sim_[name] = std::move(status);
+    }
+  }
+  entity_status_in_flight_.clear();
   for (const auto & status : res.status()) {
     auto entity_status = entity_manager_ptr_->getEntityStatus(status.name());
     if (!entity_status) {
@@ -425,13 +496,59 @@ bool API::updateEntityStatusInSim()
   return res.result().success();
 }
 
+bool API::updateEntityStatusInSim()
+{
+  simulation_api_schema::UpdateEntityStatusResponse res;
+  zeromq_client_.call(makeUpdateEntityStatusRequest(), res);
+  return applyUpdateEntityStatusResponse(res);
+}
+
 bool API::updateFrame()
 {
   boost::optional<traffic_simulator_msgs::msg::EntityStatus> ego_status_before_update = boost::none;
   entity_manager_ptr_->update(clock_.getCurrentSimulationTime(), clock_.getStepTime());
   traffic_controller_ptr_->execute();
 
-  if (not configuration.standalone_mode) {
+  if (configuration.standalone_mode) {
+    entity_manager_ptr_->broadcastEntityTransform();
+    clock_.update();
+    clock_pub_->publish(clock_.getCurrentRosTimeAsMsg());
+    debug_marker_pub_->publish(entity_manager_ptr_->makeDebugMarker());
+    metrics_manager_.calculate();
+    return true;
+  } else if (configuration.combine_frame_requests) {
+    /*
+       Nothing sent to the simulator depends on the UpdateFrameResponse, so all requests of this
+       step are sent together and the simulator is reached only once per frame. The clock is
+       advanced before sending because UpdateSensorFrame carries the time of the next frame, but
+       nothing is published until the simulator has accepted the frame, as in the other branch.
+    */
+    simulation_api_schema::UpdateStepRequest req;
+    req.mutable_update_frame()->set_current_time(clock_.getCurrentSimulationTime());
+    simulation_interface::toProto(
+      clock_.getCurrentRosTimeAsMsg().clock,
+      *req.mutable_update_frame()->mutable_current_ros_time());
+    *req.mutable_update_entity_status() = makeUpdateEntityStatusRequest();
+    if (const auto update_traffic_lights = makeUpdateTrafficLightsRequest()) {
+      *req.mutable_update_traffic_lights() = update_traffic_lights.get();
+    }
+    clock_.update();
+    *req.mutable_update_sensor_frame() = makeUpdateSensorFrameRequest();
+    simulation_api_schema::UpdateStepResponse res;
+    zeromq_client_.call(req, res);
+    if (!res.update_frame().result().success()) {
+      return false;
+    }
+    if (req.has_update_traffic_lights() and res.update_traffic_lights().result().success()) {
+      entity_manager_ptr_->acceptTrafficLightStatesBySimulator();
+    }
+    entity_manager_ptr_->broadcastEntityTransform();
+    clock_pub_->publish(clock_.getCurrentRosTimeAsMsg());
+    debug_marker_pub_->publish(entity_manager_ptr_->makeDebugMarker());
+    metrics_manager_.calculate();
+    return applyUpdateEntityStatusResponse(res.update_entity_status()) and
+           res.update_sensor_frame().result().success();
+  } else {
     simulation_api_schema::UpdateFrameRequest req;
     req.set_current_time(clock_.getCurrentSimulationTime());
     simulation_interface::toProto(
@@ -451,13 +568,6 @@ bool API::updateFrame()
     }
     updateTrafficLightsInSim();
     return updateSensorFrame();
-  } else {
-    entity_manager_ptr_->broadcastEntityTransform();
-    clock_.update();
-    clock_pub_->publish(clock_.getCurrentRosTimeAsMsg());
-    debug_marker_pub_->publish(entity_manager_ptr_->makeDebugMarker());
-    metrics_manager_.calculate();
-    return true;
   }
 }
 
@@ -301,21 +301,17 @@ void EntityBase::updateEntityStatusTimestamp(const double current_time)
 }
 
 void EntityBase::setOtherStatus(
-  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & status)
+  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & status,
+  const SpatialIndex & spatial_index)
 {
   other_status_.clear();
   if (status_) {
-    for (const auto & each : status) {
-      if (each.first != name) {
-        const auto p0 = each.second.pose.position;
-        const auto p1 = status_.get().pose.position;
-        double distance =
-          std::sqrt(std::pow(p0.x - p1.x, 2) + std::pow(p0.y - p1.y, 2) + std::pow(p0.z - p1.z, 2));
-        if (distance < 30) {
-          other_status_.insert(each);
+    spatial_index.forEachWithin(
+      status_.get().pose.position, 30, [&](const auto & other_name, const auto &) {
+        if (other_name != name) {
+          other_status_.insert(*status.find(other_name));
         }
-      }
-    }
+      });
   }
 }
 
@@ -12,7 +12,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cstdint>
+#include <exception>
 #include <geometry/bounding_box.hpp>
 #include <geometry/intersection/collision.hpp>
 #include <geometry/transform.hpp>
@@ -20,12 +22,14 @@
 #include <memory>
 #include <queue>
 #include <scenario_simulator_exception/exception.hpp>
+#include <set>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <traffic_simulator/entity/entity_manager.hpp>
 #include <traffic_simulator/helper/helper.hpp>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace traffic_simulator
@@ -75,17 +79,29 @@ bool EntityManager::checkCollision(const std::string & name0, const std::string
   if (name0 == name1 or not entityStatusSet(name0) or not entityStatusSet(name1)) {
     return false;
   }
-  auto status0 = getEntityStatus(name0);
-  if (!status0) {
-    THROW_SEMANTIC_ERROR("entity : ", name0, " status does not exist.");
-  }
-  auto status1 = getEntityStatus(name1);
-  if (!status1) {
-    THROW_SEMANTIC_ERROR("failed to calculate map pose : " + name1);
+  return getCollidingPairs().count(std::minmax(name0, name1)) != 0;
+}
+
+auto EntityManager::getCollidingPairs() const
+  -> const std::set<std::pair<std::string, std::string>> &
+{
+  if (not colliding_pairs_) {
+    std::vector<std::string> names;
+    std::vector<geometry_msgs::msg::Pose> poses;
+    std::vector<traffic_simulator_msgs::msg::BoundingBox> bboxes;
+    for (const auto & [name, entity] : entities_) {
+      if (entity->statusSet()) {
+        names.push_back(name);
+        poses.push_back(entity->getStatus().pose);
+        bboxes.push_back(entity->getBoundingBox());
+      }
+    }
+    colliding_pairs_.emplace();
+    for (const auto & [i, j] : math::geometry::getCollidingPairs(poses, bboxes)) {
+      colliding_pairs_->emplace(std::minmax(names[i], names[j]));
+    }
   }
-  auto bbox0 = getBoundingBox(name0);
-  auto bbox1 = getBoundingBox(name1);
-  return math::geometry::checkCollision2D(status0->pose, bbox0, status1->pose, bbox1);
+  return colliding_pairs_.get();
 }
 
 visualization_msgs::msg::MarkerArray EntityManager::makeDebugMarker() const
@@ -99,6 +115,7 @@ visualization_msgs::msg::MarkerArray EntityManager::makeDebugMarker() const
 
 bool EntityManager::despawnEntity(const std::string & name)
 {
+  colliding_pairs_ = boost::none;
   return entityExists(name) && entities_.erase(name);
 }
 
@@ -163,6 +180,12 @@ auto EntityManager::getEntityNames() const -> const std::vector<std::string>
   return names;
 }
 
+auto EntityManager::getEntityNamesWithin(
+  const geometry_msgs::msg::Point & point, const double radius) const -> std::vector<std::string>
+{
+  return spatial_index_.getEntityNamesWithin(point, radius);
+}
+
 auto EntityManager::getEntityStatus(const std::string & name) const
   -> const boost::optional<traffic_simulator_msgs::msg::EntityStatus>
 {
@@ -597,6 +620,7 @@ bool EntityManager::setEntityStatus(
     THROW_SEMANTIC_ERROR(
       "You cannot set entity status to the ego vehicle name:", name, " after starting scenario.");
   }
+  colliding_pairs_ = boost::none;
   return entities_.at(name)->setStatus(status);
 }
 
@@ -621,14 +645,64 @@ traffic_simulator_msgs::msg::EntityStatus EntityManager::updateNpcLogic(
   if (configuration.verbose) {
     std::cout << "update " << name << " behavior" << std::endl;
   }
-  entities_[name]->setEntityTypeList(type_list);
-  entities_[name]->onUpdate(current_time_, step_time_);
-  if (entities_[name]->statusSet()) {
-    return entities_[name]->getStatus();
+  const auto & entity = entities_.at(name);
+  entity->setEntityTypeList(type_list);
+  entity->onUpdate(current_time_, step_time_);
+  if (entity->statusSet()) {
+    return entity->getStatus();
   }
   THROW_SIMULATION_ERROR("status of entity ", name, "is empty");
 }
 
+void EntityManager::updateNpcLogicConcurrently(
+  const std::vector<std::string> & entity_names,
+  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list,
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & all_status)
+{
+  const auto update_npc_logic = [&](const std::string & name) {
+    auto status = updateNpcLogic(name, type_list);
+    status.bounding_box = getBoundingBox(name);
+    return status;
+  };
+
+  std::vector<std::string> npc_names;
+  for (const auto & entity_name : entity_names) {
+    if (not entities_.at(entity_name)->statusSet()) {
+      continue;
+    } else if (isEgo(entity_name)) {
+      all_status.emplace(entity_name, update_npc_logic(entity_name));
+    } else {
+      npc_names.push_back(entity_name);
+    }
+  }
+
+  /*
+     The OpenMP runtime keeps its threads between parallel regions, so the
+     workers are created once rather than every frame. Exceptions must not
+     leave a parallel region, so the first one is rethrown after it.
+  */
+  std::vector<traffic_simulator_msgs::msg::EntityStatus> npc_status(npc_names.size());
+  std::exception_ptr exception;
+#pragma omp parallel for schedule(dynamic)
+  for (std::size_t i = 0; i < npc_names.size(); ++i) {
+    try {
+      npc_status[i] = update_npc_logic(npc_names[i]);
+    } catch (...) {
+#pragma omp critical
+      if (not exception) {
+        exception = std::current_exception();
+      }
+    }
+  }
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+
+  for (std::size_t i = 0; i < npc_names.size(); ++i) {
+    all_status.emplace(npc_names[i], npc_status[i]);
+  }
+}
+
 void EntityManager::update(const double current_time, const double step_time)
 {
   std::chrono::system_clock::time_point start, end;
@@ -654,19 +728,25 @@ void EntityManager::update(const double current_time, const double step_time)
       all_status.emplace(entity_name, entities_[entity_name]->getStatus());
     }
   }
+  spatial_index_.build(all_status);
   for (auto it = entities_.begin(); it != entities_.end(); it++) {
-    it->second->setOtherStatus(all_status);
+    it->second->setOtherStatus(all_status, spatial_index_);
   }
   all_status.clear();
-  for (const auto & entity_name : entity_names) {
-    if (entities_[entity_name]->statusSet()) {
-      auto status = updateNpcLogic(entity_name, type_list);
-      status.bounding_box = getBoundingBox(entity_name);
-      all_status.emplace(entity_name, status);
+  if (configuration.parallel_npc_update) {
+    updateNpcLogicConcurrently(entity_names, type_list, all_status);
+  } else {
+    for (const auto & entity_name : entity_names) {
+      if (entities_[entity_name]->statusSet()) {
+        auto status = updateNpcLogic(entity_name, type_list);
+        status.bounding_box = getBoundingBox(entity_name);
+        all_status.emplace(entity_name, status);
+      }
     }
   }
+  spatial_index_.build(all_status);
   for (auto it = entities_.begin(); it != entities_.end(); it++) {
-    it->second->setOtherStatus(all_status);
+    it->second->setOtherStatus(all_status, spatial_index_);
   }
   auto entity_type_list = getEntityTypeList();
   traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray status_array_msg;
@@ -706,6 +786,7 @@ void EntityManager::update(const double current_time, const double step_time)
     status_array_msg.data.emplace_back(status_with_traj);
   }
   entity_status_array_pub_ptr_->publish(status_array_msg);
+  colliding_pairs_ = boost::none;
   end = std::chrono::system_clock::now();
   double elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
   if (configuration.verbose) {
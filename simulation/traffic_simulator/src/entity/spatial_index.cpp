@@ -0,0 +1,59 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <string>
+#include <traffic_simulator/entity/spatial_index.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace entity
+{
+SpatialIndex::SpatialIndex(double cell_size) : cell_size_(cell_size) {}
+
+void SpatialIndex::build(
+  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> & statuses)
+{
+  entries_.clear();
+  cells_.clear();
+  for (const auto & status : statuses) {
+    const auto & position = status.second.pose.position;
+    cells_[getCellKey(getCellIndex(position.x), getCellIndex(position.y))].push_back(
+      entries_.size());
+    entries_.push_back({status.first, position});
+  }
+}
+
+std::vector<std::string> SpatialIndex::getEntityNamesWithin(
+  const geometry_msgs::msg::Point & point, double radius) const
+{
+  std::vector<std::string> names;
+  forEachWithin(point, radius, [&](const auto & name, const auto &) { names.push_back(name); });
+  return names;
+}
+
+std::int64_t SpatialIndex::getCellIndex(double value) const
+{
+  return static_cast<std::int64_t>(std::floor(value / cell_size_));
+}
+
+std::int64_t SpatialIndex::getCellKey(std::int64_t x, std::int64_t y)
+{
+  return static_cast<std::int64_t>(
+    (static_cast<std::uint64_t>(x) << 32) ^ (static_cast<std::uint64_t>(y) & 0xFFFFFFFF));
+}
+}  // namespace entity
+}  // namespace traffic_simulator
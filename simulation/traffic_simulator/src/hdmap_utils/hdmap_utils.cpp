@@ -17,8 +17,13 @@
 #include <lanelet2_io/io_handlers/Serialize.h>
 #include <lanelet2_projection/UTM.h>
 #include <quaternion_operation/quaternion_operation.h>
+#include <sodium.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <boost/archive/binary_iarchive.hpp>
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/assign/list_of.hpp>
@@ -26,7 +31,11 @@
 #include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
+#include <chrono>
 #include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
 #include <geometry/linear_algebra.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <geometry/spline/hermite_curve.hpp>
@@ -40,7 +49,9 @@
 #include <memory>
 #include <scenario_simulator_exception/exception.hpp>
 #include <set>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <traffic_simulator/color_utils/color_utils.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/helper/helper.hpp>
@@ -50,36 +61,205 @@
 
 namespace hdmap_utils
 {
+namespace
+{
+// Picks the lanelet going straight ahead, or the first one if none of them does.
+boost::optional<std::int64_t> selectStraightLaneletId(
+  const LaneletGraph & lanelet_graph, const LaneletGraph::Ids & lanelet_ids)
+{
+  for (const auto lanelet_id : lanelet_ids) {
+    if (lanelet_graph.getTurnDirection(lanelet_id) == "straight") {
+      return lanelet_id;
+    }
+  }
+  if (lanelet_ids.empty()) {
+    return boost::none;
+  }
+  return lanelet_ids.front();
+}
+
+// Interval in meters between the points of the centerlines generated at map load.
+constexpr double centerline_resolution = 2.0;
+
+// Increment this whenever the format or the contents of the map cache change, including changes
+// to the preprocessing that produces them.
+constexpr int map_cache_version = 3;
+
+// Returns whether the file or directory exists, is no symbolic link, and only this user can write.
+bool isPrivate(const boost::filesystem::path & path)
+{
+  struct stat status;
+  return ::lstat(path.c_str(), &status) == 0 and not S_ISLNK(status.st_mode) and
+         status.st_uid == ::geteuid() and (status.st_mode & (S_IWGRP | S_IWOTH)) == 0;
+}
+
+/**
+ * @brief Returns where the preprocessed map of the given lanelet2 map is cached, or none if the
+ * map is not to be cached.
+ * The file name is the SHA-256 digest of the map and of everything the preprocessing depends on.
+ * map_cache_version is part of the digest, so caches written in an older format are never read.
+ */
+boost::optional<boost::filesystem::path> getMapCachePath(
+  const boost::filesystem::path & lanelet2_map_path,
+  const boost::filesystem::path & map_cache_directory)
+{
+  if (map_cache_directory.empty() or sodium_init() < 0) {
+    return boost::none;
+  }
+  std::ifstream ifs(lanelet2_map_path.string(), std::ios::binary);
+  if (!ifs) {
+    return boost::none;
+  }
+  const std::string content{std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>()};
+  std::stringstream parameters;
+  parameters << "version=" << map_cache_version << ";resolution=" << centerline_resolution;
+  const auto parameter_string = parameters.str();
+  crypto_hash_sha256_state state;
+  std::array<unsigned char, crypto_hash_sha256_BYTES> digest;
+  crypto_hash_sha256_init(&state);
+  crypto_hash_sha256_update(
+    &state, reinterpret_cast<const unsigned char *>(content.data()), content.size());
+  crypto_hash_sha256_update(
+    &state, reinterpret_cast<const unsigned char *>(parameter_string.data()),
+    parameter_string.size());
+  crypto_hash_sha256_final(&state, digest.data());
+  std::array<char, crypto_hash_sha256_BYTES * 2 + 1> file_name;
+  sodium_bin2hex(file_name.data(), file_name.size(), digest.data(), digest.size());
+  try {
+    if (not boost::filesystem::exists(map_cache_directory)) {
+      boost::filesystem::create_directories(map_cache_directory);
+      boost::filesystem::permissions(map_cache_directory, boost::filesystem::owner_all);
+    }
+  } catch (const boost::filesystem::filesystem_error &) {
+    return boost::none;
+  }
+  if (not isPrivate(map_cache_directory)) {
+    return boost::none;
+  }
+  return map_cache_directory / (std::string(file_name.data()) + ".bin");
+}
+
+// Calls function(i) for every i in [0, size), spreading the calls over all cores.
+template <typename Function>
+void parallelFor(std::size_t size, const Function & function)
+{
+  std::atomic<std::size_t> next_index{0};
+  const auto work = [&]() {
+    for (auto i = next_index++; i < size; i = next_index++) {
+      function(i);
+    }
+  };
+  const auto worker_count =
+    std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u), size);
+  std::vector<std::future<void>> workers;
+  for (std::size_t i = 1; i < worker_count; ++i) {
+    workers.push_back(std::async(std::launch::async, work));
+  }
+  work();
+  for (auto & worker : workers) {
+    worker.get();
+  }
+}
+
+// Builds the centerline cache in the order of lanelet_ids, constructing the splines in parallel.
+CenterlineCache makeCenterlineCache(
+  const std::vector<std::int64_t> & lanelet_ids,
+  const std::vector<std::vector<geometry_msgs::msg::Point>> & center_points,
+  const std::vector<double> & lengths)
+{
+  std::vector<std::shared_ptr<math::geometry::CatmullRomSpline>> splines(lanelet_ids.size());
+  parallelFor(lanelet_ids.size(), [&](std::size_t i) {
+    if (center_points[i].size() >= 3) {
+      splines[i] = std::make_shared<math::geometry::CatmullRomSpline>(center_points[i]);
+    }
+  });
+  CenterlineCache centerline_cache;
+  for (std::size_t i = 0; i < lanelet_ids.size(); ++i) {
+    centerline_cache.appendData(lanelet_ids[i], center_points[i], lengths[i], splines[i]);
+  }
+  return centerline_cache;
+}
+}  // namespace
+
 HdMapUtils::HdMapUtils(
-  const boost::filesystem::path & lanelet2_map_path, const geographic_msgs::msg::GeoPoint &)
+  const boost::filesystem::path & lanelet2_map_path, const geographic_msgs::msg::GeoPoint &,
+  const boost::filesystem::path & map_cache_directory, double longitudinal_distance_horizon)
 {
-  lanelet::projection::MGRSProjector projector;
+  auto phase_start = std::chrono::steady_clock::now();
+  const auto end_phase = [&](const std::string & phase) {
+    const auto now = std::chrono::steady_clock::now();
+    load_phase_durations_.emplace_back(
+      phase, std::chrono::duration<double>(now - phase_start).count());
+    phase_start = now;
+  };
+
+  const auto cache_path = getMapCachePath(lanelet2_map_path, map_cache_directory);
 
-  lanelet::ErrorMessages errors;
+  if (cache_path and loadMapCache(cache_path.get())) {
+    end_phase("load map cache");
+  } else {
+    lanelet::projection::MGRSProjector projector;
+
+    lanelet::ErrorMessages errors;
 
-  lanelet_map_ptr_ = lanelet::load(lanelet2_map_path.string(), projector, &errors);
+    lanelet_map_ptr_ = lanelet::load(lanelet2_map_path.string(), projector, &errors);
 
-  if (not errors.empty()) {
-    std::stringstream ss;
-    const auto * separator = "";
-    for (const auto & error : errors) {
-      ss << separator << error;
-      separator = "\n";
+    if (not errors.empty()) {
+      std::stringstream ss;
+      const auto * separator = "";
+      for (const auto & error : errors) {
+        ss << separator << error;
+        separator = "\n";
+      }
+      THROW_SIMULATION_ERROR("Failed to load lanelet map (", ss.str(), ")");
+    }
+    end_phase("parse map");
+    overwriteLaneletsCenterline();
+    end_phase("generate centerlines");
+    const std::vector<lanelet::ConstLanelet> lanelets(
+      lanelet_map_ptr_->laneletLayer.begin(), lanelet_map_ptr_->laneletLayer.end());
+    std::vector<std::int64_t> lanelet_ids(lanelets.size());
+    std::vector<std::vector<geometry_msgs::msg::Point>> center_points(lanelets.size());
+    std::vector<double> lengths(lanelets.size());
+    parallelFor(lanelets.size(), [&](std::size_t i) {
+      lanelet_ids[i] = lanelets[i].id();
+      center_points[i] = toCenterPoints(lanelets[i]);
+      lengths[i] = lanelet::utils::getLaneletLength2d(lanelets[i]);
+    });
+    centerline_cache_ = makeCenterlineCache(lanelet_ids, center_points, lengths);
+    end_phase("build centerline cache");
+    if (cache_path) {
+      saveMapCache(cache_path.get());
+      end_phase("save map cache");
     }
-    THROW_SIMULATION_ERROR("Failed to load lanelet map (", ss.str(), ")");
   }
-  overwriteLaneletsCenterline();
   traffic_rules_vehicle_ptr_ = lanelet::traffic_rules::TrafficRulesFactory::create(
     lanelet::Locations::Germany, lanelet::Participants::Vehicle);
-  vehicle_routing_graph_ptr_ =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *traffic_rules_vehicle_ptr_);
   traffic_rules_pedestrian_ptr_ = lanelet::traffic_rules::TrafficRulesFactory::create(
     lanelet::Locations::Germany, lanelet::Participants::Pedestrian);
-  pedestrian_routing_graph_ptr_ =
-    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *traffic_rules_pedestrian_ptr_);
-  std::vector<lanelet::routing::RoutingGraphConstPtr> all_graphs;
-  all_graphs.push_back(vehicle_routing_graph_ptr_);
-  all_graphs.push_back(pedestrian_routing_graph_ptr_);
+  /**
+   * @note The routing graphs only read the map, so the pedestrian routing graph is built on another
+   * thread while the vehicle routing graph and the tables depending on it are built on this one.
+   * Every centerline has been generated already, so no lanelet computes its centerline lazily.
+   */
+  auto pedestrian_routing_graph = std::async(std::launch::async, [this]() {
+    return lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *traffic_rules_pedestrian_ptr_);
+  });
+  vehicle_routing_graph_ptr_ =
+    lanelet::routing::RoutingGraph::build(*lanelet_map_ptr_, *traffic_rules_vehicle_ptr_);
+  end_phase("build vehicle routing graph");
+  lanelet_graph_ = LaneletGraph(lanelet_map_ptr_, vehicle_routing_graph_ptr_);
+  end_phase("build lanelet graph");
+  longitudinal_distance_index_ = std::make_unique<const LongitudinalDistanceIndex>(
+    lanelet_graph_, centerline_cache_, longitudinal_distance_horizon);
+  pedestrian_routing_graph_ptr_ = pedestrian_routing_graph.get();
+  end_phase("wait for pedestrian routing graph");
+}
+
+auto HdMapUtils::getLoadPhaseDurations() const
+  -> const std::vector<std::pair<std::string, double>> &
+{
+  return load_phase_durations_;
 }
 
 const std::vector<std::int64_t> HdMapUtils::getLaneletIds()
@@ -185,7 +365,7 @@ boost::optional<double> HdMapUtils::getCollisionPointInLaneCoordinate(
   using Point = bg::model::d2::point_xy<double>;
   using Line = bg::model::linestring<Point>;
   using Polygon = bg::model::polygon<Point, false>;
-  auto center_points = getCenterPoints(lanelet_id);
+  const auto & center_points = getCenterPoints(lanelet_id);
   std::vector<Point> path_collision_points;
   lanelet_map_ptr_->laneletLayer.get(crossing_lanelet_id);
   lanelet::CompoundPolygon3d lanelet_polygon =
@@ -231,12 +411,8 @@ std::vector<std::int64_t> HdMapUtils::getConflictingLaneIds(
 {
   std::vector<std::int64_t> ret;
   for (const auto & lanelet_id : lanelet_ids) {
-    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-    const auto conflicting_lanelets =
-      lanelet::utils::getConflictingLanelets(vehicle_routing_graph_ptr_, lanelet);
-    for (const auto & conflicting_lanelet : conflicting_lanelets) {
-      ret.emplace_back(conflicting_lanelet.id());
-    }
+    const auto conflicting_lanelet_ids = lanelet_graph_.getConflicting(lanelet_id);
+    ret.insert(ret.end(), conflicting_lanelet_ids.begin(), conflicting_lanelet_ids.end());
   }
   return ret;
 }
@@ -562,21 +738,17 @@ boost::optional<int64_t> HdMapUtils::getLaneChangeableLaneletId(
 boost::optional<std::int64_t> HdMapUtils::getLaneChangeableLaneletId(
   std::int64_t lanelet_id, traffic_simulator::lane_change::Direction direction)
 {
-  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
   boost::optional<std::int64_t> target = boost::none;
   switch (direction) {
     case traffic_simulator::lane_change::Direction::STRAIGHT:
-      target = lanelet.id();
+      lanelet_graph_.getIndex(lanelet_id);
+      target = lanelet_id;
       break;
     case traffic_simulator::lane_change::Direction::LEFT:
-      if (vehicle_routing_graph_ptr_->left(lanelet)) {
-        target = vehicle_routing_graph_ptr_->left(lanelet)->id();
-      }
+      target = lanelet_graph_.getLeft(lanelet_id);
       break;
     case traffic_simulator::lane_change::Direction::RIGHT:
-      if (vehicle_routing_graph_ptr_->right(lanelet)) {
-        target = vehicle_routing_graph_ptr_->right(lanelet)->id();
-      }
+      target = lanelet_graph_.getRight(lanelet_id);
       break;
   }
   return target;
@@ -588,23 +760,14 @@ std::vector<std::int64_t> HdMapUtils::getPreviousLanelets(std::int64_t lanelet_i
   double total_distance = 0.0;
   ret.push_back(lanelet_id);
   while (total_distance < distance) {
-    auto ids = getPreviousLaneletIds(lanelet_id, "straight");
-    if (ids.size() != 0) {
-      lanelet_id = ids[0];
-      total_distance = total_distance + getLaneletLength(lanelet_id);
-      ret.push_back(lanelet_id);
-      continue;
-    } else {
-      auto else_ids = getPreviousLaneletIds(lanelet_id);
-      if (else_ids.size() != 0) {
-        lanelet_id = else_ids[0];
-        total_distance = total_distance + getLaneletLength(lanelet_id);
-        ret.push_back(lanelet_id);
-        continue;
-      } else {
-        break;
-      }
+    const auto previous_lanelet_id =
+      selectStraightLaneletId(lanelet_graph_, lanelet_graph_.getPrevious(lanelet_id));
+    if (!previous_lanelet_id) {
+      break;
     }
+    lanelet_id = previous_lanelet_id.get();
+    total_distance = total_distance + getLaneletLength(lanelet_id);
+    ret.push_back(lanelet_id);
   }
   return ret;
 }
@@ -665,22 +828,14 @@ std::vector<std::int64_t> HdMapUtils::getFollowingLanelets(
     ret.push_back(lanelet_id);
   }
   while (total_distance < distance) {
-    const auto straight_ids = getNextLaneletIds(lanelet_id, "straight");
-    if (straight_ids.size() != 0) {
-      lanelet_id = straight_ids[0];
-      total_distance = total_distance + getLaneletLength(lanelet_id);
-      ret.push_back(lanelet_id);
-      continue;
-    }
-    const auto ids = getNextLaneletIds(lanelet_id);
-    if (ids.size() != 0) {
-      lanelet_id = ids[0];
-      total_distance = total_distance + getLaneletLength(lanelet_id);
-      ret.push_back(lanelet_id);
-      continue;
-    } else {
+    const auto next_lanelet_id =
+      selectStraightLaneletId(lanelet_graph_, lanelet_graph_.getNext(lanelet_id));
+    if (!next_lanelet_id) {
       break;
     }
+    lanelet_id = next_lanelet_id.get();
+    total_distance = total_distance + getLaneletLength(lanelet_id);
+    ret.push_back(lanelet_id);
   }
   return ret;
 }
@@ -688,8 +843,8 @@ std::vector<std::int64_t> HdMapUtils::getFollowingLanelets(
 std::vector<std::int64_t> HdMapUtils::getRoute(
   std::int64_t from_lanelet_id, std::int64_t to_lanelet_id)
 {
-  if (route_cache_.exists(from_lanelet_id, to_lanelet_id)) {
-    return route_cache_.getRoute(from_lanelet_id, to_lanelet_id);
+  if (const auto cached_route = route_cache_.getRoute(from_lanelet_id, to_lanelet_id)) {
+    return cached_route.get();
   }
   std::vector<std::int64_t> ret;
   const auto lanelet = lanelet_map_ptr_->laneletLayer.get(from_lanelet_id);
@@ -712,44 +867,38 @@ std::vector<std::int64_t> HdMapUtils::getRoute(
   return ret;
 }
 
-std::shared_ptr<math::geometry::CatmullRomSpline> HdMapUtils::getCenterPointsSpline(
-  std::int64_t lanelet_id)
+const std::shared_ptr<math::geometry::CatmullRomSpline> & HdMapUtils::getCenterPointsSpline(
+  std::int64_t lanelet_id) const
 {
-  getCenterPoints(lanelet_id);
-  return center_points_cache_.getCenterPointsSpline(lanelet_id);
+  return centerline_cache_.getCenterPointsSpline(lanelet_id);
 }
 
 std::vector<geometry_msgs::msg::Point> HdMapUtils::getCenterPoints(
-  std::vector<std::int64_t> lanelet_ids)
+  std::vector<std::int64_t> lanelet_ids) const
 {
   std::vector<geometry_msgs::msg::Point> ret;
   if (lanelet_ids.empty()) {
     return ret;
   }
   for (const auto lanelet_id : lanelet_ids) {
-    std::vector<geometry_msgs::msg::Point> center_points = getCenterPoints(lanelet_id);
+    const auto & center_points = getCenterPoints(lanelet_id);
     std::copy(center_points.begin(), center_points.end(), std::back_inserter(ret));
   }
   ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
   return ret;
 }
 
-std::vector<geometry_msgs::msg::Point> HdMapUtils::getCenterPoints(std::int64_t lanelet_id)
+const std::vector<geometry_msgs::msg::Point> & HdMapUtils::getCenterPoints(
+  std::int64_t lanelet_id) const
 {
-  std::vector<geometry_msgs::msg::Point> ret;
-  if (!lanelet_map_ptr_) {
-    THROW_SIMULATION_ERROR("lanelet map is null pointer");
-  }
-  if (lanelet_map_ptr_->laneletLayer.empty()) {
-    THROW_SIMULATION_ERROR("lanelet layer is empty");
-  }
-  if (center_points_cache_.exists(lanelet_id)) {
-    return center_points_cache_.getCenterPoints(lanelet_id);
-  }
+  return centerline_cache_.getCenterPoints(lanelet_id);
+}
 
-  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-  const auto centerline = lanelet.centerline();
-  for (const auto & point : centerline) {
+std::vector<geometry_msgs::msg::Point> HdMapUtils::toCenterPoints(
+  const lanelet::ConstLanelet & lanelet) const
+{
+  std::vector<geometry_msgs::msg::Point> ret;
+  for (const auto & point : lanelet.centerline()) {
     geometry_msgs::msg::Point p;
     p.x = point.x();
     p.y = point.y();
@@ -768,41 +917,27 @@ std::vector<geometry_msgs::msg::Point> HdMapUtils::getCenterPoints(std::int64_t
     ret.push_back(p1);
     ret.push_back(p2);
   }
-  center_points_cache_.appendData(lanelet_id, ret);
   return ret;
 }
 
-double HdMapUtils::getLaneletLength(std::int64_t lanelet_id)
+double HdMapUtils::getLaneletLength(std::int64_t lanelet_id) const
 {
-  if (lanelet_length_cache_.exists(lanelet_id)) {
-    return lanelet_length_cache_.getLength(lanelet_id);
-  }
-  double ret = lanelet::utils::getLaneletLength2d(lanelet_map_ptr_->laneletLayer.get(lanelet_id));
-  lanelet_length_cache_.appendData(lanelet_id, ret);
-  return ret;
+  return centerline_cache_.getLength(lanelet_id);
 }
 
 std::vector<std::int64_t> HdMapUtils::getPreviousLaneletIds(std::int64_t lanelet_id) const
 {
-  std::vector<std::int64_t> ret;
-  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-  const auto previous_lanelets = vehicle_routing_graph_ptr_->previous(lanelet);
-  for (const auto & llt : previous_lanelets) {
-    ret.push_back(llt.id());
-  }
-  return ret;
+  const auto previous_lanelet_ids = lanelet_graph_.getPrevious(lanelet_id);
+  return {previous_lanelet_ids.begin(), previous_lanelet_ids.end()};
 }
 
 std::vector<std::int64_t> HdMapUtils::getPreviousLaneletIds(
-  std::int64_t lanelet_id, std::string turn_direction)
+  std::int64_t lanelet_id, std::string turn_direction) const
 {
   std::vector<std::int64_t> ret;
-  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-  const auto previous_lanelets = vehicle_routing_graph_ptr_->previous(lanelet);
-  for (const auto & llt : previous_lanelets) {
-    const std::string turn_direction_llt = llt.attributeOr("turn_direction", "else");
-    if (turn_direction_llt == turn_direction) {
-      ret.push_back(llt.id());
+  for (const auto previous_lanelet_id : lanelet_graph_.getPrevious(lanelet_id)) {
+    if (lanelet_graph_.getTurnDirection(previous_lanelet_id) == turn_direction) {
+      ret.push_back(previous_lanelet_id);
     }
   }
   return ret;
@@ -810,25 +945,17 @@ std::vector<std::int64_t> HdMapUtils::getPreviousLaneletIds(
 
 std::vector<std::int64_t> HdMapUtils::getNextLaneletIds(std::int64_t lanelet_id) const
 {
-  std::vector<std::int64_t> ret;
-  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-  const auto following_lanelets = vehicle_routing_graph_ptr_->following(lanelet);
-  for (const auto & llt : following_lanelets) {
-    ret.push_back(llt.id());
-  }
-  return ret;
+  const auto next_lanelet_ids = lanelet_graph_.getNext(lanelet_id);
+  return {next_lanelet_ids.begin(), next_lanelet_ids.end()};
 }
 
 std::vector<std::int64_t> HdMapUtils::getNextLaneletIds(
-  std::int64_t lanelet_id, std::string turn_direction)
+  std::int64_t lanelet_id, std::string turn_direction) const
 {
   std::vector<std::int64_t> ret;
-  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-  const auto following_lanelets = vehicle_routing_graph_ptr_->following(lanelet);
-  for (const auto & llt : following_lanelets) {
-    const std::string turn_direction_llt = llt.attributeOr("turn_direction", "else");
-    if (turn_direction_llt == turn_direction) {
-      ret.push_back(llt.id());
+  for (const auto next_lanelet_id : lanelet_graph_.getNext(lanelet_id)) {
+    if (lanelet_graph_.getTurnDirection(next_lanelet_id) == turn_direction) {
+      ret.push_back(next_lanelet_id);
     }
   }
   return ret;
@@ -889,31 +1016,27 @@ traffic_simulator_msgs::msg::LaneletPose HdMapUtils::getAlongLaneletPose(
   along_pose.s = along_pose.s + along;
   if (along_pose.s >= 0) {
     while (along_pose.s >= getLaneletLength(along_pose.lanelet_id)) {
-      auto next_ids = getNextLaneletIds(along_pose.lanelet_id, "straight");
-      if (next_ids.empty()) {
-        next_ids = getNextLaneletIds(along_pose.lanelet_id);
-        if (next_ids.empty()) {
-          THROW_SEMANTIC_ERROR(
-            "failed to calculate along pose (id,s) = (", from_pose.lanelet_id, ",",
-            from_pose.s + along, "), next lanelet of id = ", along_pose.lanelet_id, "is empty.");
-        }
+      const auto next_lanelet_id =
+        selectStraightLaneletId(lanelet_graph_, lanelet_graph_.getNext(along_pose.lanelet_id));
+      if (!next_lanelet_id) {
+        THROW_SEMANTIC_ERROR(
+          "failed to calculate along pose (id,s) = (", from_pose.lanelet_id, ",",
+          from_pose.s + along, "), next lanelet of id = ", along_pose.lanelet_id, "is empty.");
       }
       along_pose.s = along_pose.s - getLaneletLength(along_pose.lanelet_id);
-      along_pose.lanelet_id = next_ids[0];
+      along_pose.lanelet_id = next_lanelet_id.get();
     }
   } else {
     while (along_pose.s < 0) {
-      auto previous_ids = getPreviousLaneletIds(along_pose.lanelet_id, "straight");
-      if (previous_ids.empty()) {
-        previous_ids = getPreviousLaneletIds(along_pose.lanelet_id);
-        if (previous_ids.empty()) {
-          THROW_SEMANTIC_ERROR(
-            "failed to calculate along pose (id,s) = (", from_pose.lanelet_id, ",",
-            from_pose.s + along, "), next lanelet of id = ", along_pose.lanelet_id, "is empty.");
-        }
+      const auto previous_lanelet_id = selectStraightLaneletId(
+        lanelet_graph_, lanelet_graph_.getPrevious(along_pose.lanelet_id));
+      if (!previous_lanelet_id) {
+        THROW_SEMANTIC_ERROR(
+          "failed to calculate along pose (id,s) = (", from_pose.lanelet_id, ",",
+          from_pose.s + along, "), next lanelet of id = ", along_pose.lanelet_id, "is empty.");
       }
-      along_pose.s = along_pose.s + getLaneletLength(previous_ids[0]);
-      along_pose.lanelet_id = previous_ids[0];
+      along_pose.s = along_pose.s + getLaneletLength(previous_lanelet_id.get());
+      along_pose.lanelet_id = previous_lanelet_id.get();
     }
   }
   return along_pose;
@@ -1159,6 +1282,11 @@ boost::optional<double> HdMapUtils::getLongitudinalDistance(
       return to_s - from_s;
     }
   }
+  if (
+    const auto offset = longitudinal_distance_index_->getOffset(
+      lanelet_graph_.getIndex(from_lanelet_id), to_lanelet_id)) {
+    return offset.get() - from_s + to_s;
+  }
   const auto route = getRoute(from_lanelet_id, to_lanelet_id);
   if (route.empty()) {
     return boost::none;
@@ -1259,14 +1387,110 @@ const visualization_msgs::msg::MarkerArray HdMapUtils::generateMarker() const
   return markers;
 }
 
+/**
+ * @brief Loads the map, its resampled centerlines and their lengths from the map cache.
+ * @return false if there is no usable cache, in which case nothing is modified.
+ */
+bool HdMapUtils::loadMapCache(const boost::filesystem::path & cache_path)
+{
+  if (not isPrivate(cache_path)) {
+    return false;
+  }
+  std::ifstream ifs(cache_path.string(), std::ios::binary);
+  if (!ifs) {
+    return false;
+  }
+  try {
+    boost::archive::binary_iarchive ia(ifs);
+    auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
+    ia >> *lanelet_map_ptr;
+    lanelet::Id id_counter;
+    ia >> id_counter;
+    std::size_t lanelet_count;
+    ia >> lanelet_count;
+    std::vector<std::int64_t> lanelet_ids(lanelet_count);
+    std::vector<std::vector<geometry_msgs::msg::Point>> center_points(lanelet_count);
+    std::vector<double> lengths(lanelet_count);
+    for (std::size_t i = 0; i < lanelet_count; ++i) {
+      std::size_t point_count;
+      ia >> lanelet_ids[i] >> lengths[i] >> point_count;
+      center_points[i].resize(point_count);
+      for (auto & point : center_points[i]) {
+        ia >> point.x >> point.y >> point.z;
+      }
+    }
+    lanelet_map_ptr_ = lanelet_map_ptr;
+    lanelet::utils::registerId(id_counter);
+    centerline_cache_ = makeCenterlineCache(lanelet_ids, center_points, lengths);
+    return true;
+  } catch (const std::exception &) {
+    return false;
+  }
+}
+
+/**
+ * @brief Saves the map, its resampled centerlines and their lengths to the map cache.
+ * The cache is written to a temporary file which is then renamed, so other processes loading the
+ * same map never read a partially written cache. Failing to write the cache is not an error.
+ */
+void HdMapUtils::saveMapCache(const boost::filesystem::path & cache_path) const
+{
+  const auto temporary_path =
+    cache_path.parent_path() / boost::filesystem::unique_path("%%%%-%%%%-%%%%-%%%%.tmp");
+  try {
+    {
+      std::ofstream ofs(temporary_path.string(), std::ios::binary);
+      boost::archive::binary_oarchive oa(ofs);
+      oa << *lanelet_map_ptr_;
+      auto id_counter = lanelet::utils::getId();
+      oa << id_counter;
+      std::size_t lanelet_count = lanelet_map_ptr_->laneletLayer.size();
+      oa << lanelet_count;
+      for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+        std::int64_t lanelet_id = lanelet.id();
+        double length = centerline_cache_.getLength(lanelet_id);
+        const auto & center_points = centerline_cache_.getCenterPoints(lanelet_id);
+        std::size_t point_count = center_points.size();
+        oa << lanelet_id << length << point_count;
+        for (const auto & point : center_points) {
+          oa << point.x << point.y << point.z;
+        }
+      }
+    }
+    boost::filesystem::permissions(
+      temporary_path, boost::filesystem::owner_read | boost::filesystem::owner_write);
+    boost::filesystem::rename(temporary_path, cache_path);
+  } catch (const std::exception &) {
+    // NOTE: The map will be preprocessed again next time.
+    boost::system::error_code error_code;
+    boost::filesystem::remove(temporary_path, error_code);
+  }
+}
+
 void HdMapUtils::overwriteLaneletsCenterline()
 {
+  std::vector<lanelet::Lanelet> lanelets;
   for (auto & lanelet_obj : lanelet_map_ptr_->laneletLayer) {
     if (!lanelet_obj.hasCustomCenterline()) {
-      const auto fine_center_line = generateFineCenterline(lanelet_obj, 2.0);
-      lanelet_obj.setCenterline(fine_center_line);
+      lanelets.push_back(lanelet_obj);
     }
   }
+  std::vector<std::vector<lanelet::BasicPoint3d>> center_points(lanelets.size());
+  parallelFor(lanelets.size(), [&](std::size_t i) {
+    center_points[i] = generateFineCenterPoints(lanelets[i], centerline_resolution);
+  });
+  /**
+   * @note Ids of the centerline points are assigned here in the order of the lanelet layer, so the
+   * resulting map does not depend on how the resampling was scheduled.
+   */
+  for (std::size_t i = 0; i < lanelets.size(); ++i) {
+    lanelet::LineString3d centerline(lanelet::utils::getId());
+    for (const auto & center_point : center_points[i]) {
+      centerline.push_back(lanelet::Point3d(
+        lanelet::utils::getId(), center_point.x(), center_point.y(), center_point.z()));
+    }
+    lanelets[i].setCenterline(centerline);
+  }
 }
 
 std::pair<size_t, size_t> HdMapUtils::findNearestIndexPair(
@@ -1308,18 +1532,8 @@ HdMapUtils::getRightOfWayLaneletIds(std::vector<std::int64_t> lanelet_ids) const
 
 const std::vector<std::int64_t> HdMapUtils::getRightOfWayLaneletIds(std::int64_t lanelet_id) const
 {
-  std::vector<std::int64_t> ret;
-  const auto & assigned_lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-  const auto right_of_ways = assigned_lanelet.regulatoryElementsAs<lanelet::RightOfWay>();
-  for (const auto & right_of_way : right_of_ways) {
-    const auto right_of_Way_lanelets = right_of_way->rightOfWayLanelets();
-    for (const auto & ll : right_of_Way_lanelets) {
-      if (lanelet_id != ll.id()) {
-        ret.emplace_back(ll.id());
-      }
-    }
-  }
-  return ret;
+  const auto right_of_way_lanelet_ids = lanelet_graph_.getRightOfWay(lanelet_id);
+  return {right_of_way_lanelet_ids.begin(), right_of_way_lanelet_ids.end()};
 }
 
 std::vector<std::shared_ptr<const lanelet::TrafficSign>>
@@ -1656,6 +1870,17 @@ std::vector<lanelet::BasicPoint3d> HdMapUtils::resamplePoints(
 
 lanelet::LineString3d HdMapUtils::generateFineCenterline(
   const lanelet::ConstLanelet & lanelet_obj, const double resolution)
+{
+  lanelet::LineString3d centerline(lanelet::utils::getId());
+  for (const auto & center_point : generateFineCenterPoints(lanelet_obj, resolution)) {
+    centerline.push_back(lanelet::Point3d(
+      lanelet::utils::getId(), center_point.x(), center_point.y(), center_point.z()));
+  }
+  return centerline;
+}
+
+std::vector<lanelet::BasicPoint3d> HdMapUtils::generateFineCenterPoints(
+  const lanelet::ConstLanelet & lanelet_obj, const double resolution)
 {
   // Get length of longer border
   const double left_length =
@@ -1671,16 +1896,12 @@ lanelet::LineString3d HdMapUtils::generateFineCenterline(
   const auto right_points = resamplePoints(lanelet_obj.rightBound(), num_segments);
 
   // Create centerline
-  lanelet::LineString3d centerline(lanelet::utils::getId());
+  std::vector<lanelet::BasicPoint3d> center_points;
   for (size_t i = 0; i < static_cast<size_t>(num_segments + 1); i++) {
-    // Add ID for the average point of left and right
-    const auto center_basic_point = (right_points.at(i) + left_points.at(i)) / 2.0;
-    const lanelet::Point3d center_point(
-      lanelet::utils::getId(), center_basic_point.x(), center_basic_point.y(),
-      center_basic_point.z());
-    centerline.push_back(center_point);
+    // Average point of left and right
+    center_points.push_back((right_points.at(i) + left_points.at(i)) / 2.0);
   }
-  return centerline;
+  return center_points;
 }
 
 std::vector<double> HdMapUtils::calcEuclidDist(
@@ -0,0 +1,109 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lanelet2_extension_psim/utility/utilities.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/hdmap_utils/lanelet_graph.hpp>
+#include <vector>
+
+namespace hdmap_utils
+{
+LaneletGraph::LaneletGraph(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr,
+  const lanelet::routing::RoutingGraphConstPtr & vehicle_routing_graph_ptr)
+{
+  const auto & lanelets = lanelet_map_ptr->laneletLayer;
+  index_.reserve(lanelets.size());
+  ids_.reserve(lanelets.size());
+  left_.reserve(lanelets.size());
+  right_.reserve(lanelets.size());
+  turn_directions_.reserve(lanelets.size());
+  for (const auto & lanelet : lanelets) {
+    index_.emplace(lanelet.id(), ids_.size());
+    ids_.push_back(lanelet.id());
+    next_.append(vehicle_routing_graph_ptr->following(lanelet));
+    previous_.append(vehicle_routing_graph_ptr->previous(lanelet));
+    conflicting_.append(
+      lanelet::utils::getConflictingLanelets(vehicle_routing_graph_ptr, lanelet));
+    std::vector<lanelet::ConstLanelet> right_of_way_lanelets;
+    for (const auto & right_of_way : lanelet.regulatoryElementsAs<lanelet::RightOfWay>()) {
+      for (const auto & right_of_way_lanelet : right_of_way->rightOfWayLanelets()) {
+        if (right_of_way_lanelet.id() != lanelet.id()) {
+          right_of_way_lanelets.push_back(right_of_way_lanelet);
+        }
+      }
+    }
+    right_of_way_.append(right_of_way_lanelets);
+    const auto left = vehicle_routing_graph_ptr->left(lanelet);
+    left_.push_back(left ? boost::make_optional(left->id()) : boost::none);
+    const auto right = vehicle_routing_graph_ptr->right(lanelet);
+    right_.push_back(right ? boost::make_optional(right->id()) : boost::none);
+    turn_directions_.push_back(lanelet.attributeOr("turn_direction", "else"));
+  }
+}
+
+bool LaneletGraph::contains(std::int64_t lanelet_id) const
+{
+  return index_.find(lanelet_id) != index_.end();
+}
+
+std::size_t LaneletGraph::getIndex(std::int64_t lanelet_id) const
+{
+  const auto iter = index_.find(lanelet_id);
+  if (iter == index_.end()) {
+    THROW_SIMULATION_ERROR("lanelet : ", lanelet_id, " does not exists on lanelet graph.");
+  }
+  return iter->second;
+}
+
+const std::vector<std::int64_t> & LaneletGraph::getIds() const { return ids_; }
+
+std::size_t LaneletGraph::size() const { return ids_.size(); }
+
+auto LaneletGraph::getNext(std::int64_t lanelet_id) const -> Ids
+{
+  return next_[getIndex(lanelet_id)];
+}
+
+auto LaneletGraph::getPrevious(std::int64_t lanelet_id) const -> Ids
+{
+  return previous_[getIndex(lanelet_id)];
+}
+
+auto LaneletGraph::getConflicting(std::int64_t lanelet_id) const -> Ids
+{
+  return conflicting_[getIndex(lanelet_id)];
+}
+
+auto LaneletGraph::getRightOfWay(std::int64_t lanelet_id) const -> Ids
+{
+  return right_of_way_[getIndex(lanelet_id)];
+}
+
+const boost::optional<std::int64_t> & LaneletGraph::getLeft(std::int64_t lanelet_id) const
+{
+  return left_[getIndex(lanelet_id)];
+}
+
+const boost::optional<std::int64_t> & LaneletGraph::getRight(std::int64_t lanelet_id) const
+{
+  return right_[getIndex(lanelet_id)];
+}
+
+const std::string & LaneletGraph::getTurnDirection(std::int64_t lanelet_id) const
+{
+  return turn_directions_[getIndex(lanelet_id)];
+}
+}  // namespace hdmap_utils
@@ -0,0 +1,109 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <traffic_simulator/hdmap_utils/longitudinal_distance_index.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hdmap_utils
+{
+LongitudinalDistanceIndex::LongitudinalDistanceIndex(
+  const LaneletGraph & lanelet_graph, const CenterlineCache & centerline_cache, double horizon)
+: lanelet_graph_(lanelet_graph), horizon_(horizon), rows_(lanelet_graph.size())
+{
+  lengths_.reserve(lanelet_graph.size());
+  for (const auto id : lanelet_graph.getIds()) {
+    lengths_.push_back(centerline_cache.getLength(id));
+  }
+}
+
+boost::optional<double> LongitudinalDistanceIndex::getOffset(
+  std::size_t from_index, std::int64_t to_lanelet_id) const
+{
+  if (from_index >= rows_.size()) {
+    return boost::none;
+  }
+  const auto & row = getRow(from_index);
+  const auto iter = std::lower_bound(
+    row.begin(), row.end(), to_lanelet_id,
+    [](const auto & entry, const auto & lanelet_id) { return entry.first < lanelet_id; });
+  if (iter == row.end() || iter->first != to_lanelet_id) {
+    return boost::none;
+  }
+  return iter->second;
+}
+
+auto LongitudinalDistanceIndex::getRow(std::size_t from_index) const -> const Row &
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (rows_[from_index]) {
+      return *rows_[from_index];
+    }
+  }
+  auto row = std::make_unique<const Row>(search(from_index));
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!rows_[from_index]) {
+    rows_[from_index] = std::move(row);
+  }
+  return *rows_[from_index];
+}
+
+/**
+ * @note Dijkstra search over successors from the lanelet at from_index, which stops expanding at
+ * lanelets whose end is farther than the horizon.
+ */
+auto LongitudinalDistanceIndex::search(std::size_t from_index) const -> Row
+{
+  const auto & ids = lanelet_graph_.getIds();
+  using Entry = std::pair<double, std::size_t>;
+  std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+  std::unordered_map<std::size_t, double> distances;
+  distances.emplace(from_index, 0.0);
+  queue.emplace(0.0, from_index);
+  Row row;
+  while (!queue.empty()) {
+    const auto [distance, index] = queue.top();
+    queue.pop();
+    if (distance > distances[index]) {
+      continue;
+    }
+    if (index != from_index) {
+      row.emplace_back(ids[index], distance);
+    }
+    const auto next_distance = distance + lengths_[index];
+    if (next_distance > horizon_) {
+      continue;
+    }
+    for (const auto next_id : lanelet_graph_.getNext(ids[index])) {
+      const auto next = lanelet_graph_.getIndex(next_id);
+      if (const auto iter = distances.find(next);
+          iter == distances.end() || next_distance < iter->second) {
+        distances[next] = next_distance;
+        queue.emplace(next_distance, next);
+      }
+    }
+  }
+  std::sort(row.begin(), row.end());
+  return row;
+}
+
+double LongitudinalDistanceIndex::getHorizon() const { return horizon_; }
+}  // namespace hdmap_utils
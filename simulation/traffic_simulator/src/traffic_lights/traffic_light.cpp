@@ -274,6 +274,15 @@ auto TrafficLight::set(const std::string & states) -> void
   }
 }
 
+auto TrafficLight::hashes() const -> std::vector<Bulb::Hash>
+{
+  std::vector<Bulb::Hash> result;
+  for (auto && bulb : bulbs) {
+    result.push_back(bulb.hash());
+  }
+  return result;
+}
+
 TrafficLight::operator autoware_auto_perception_msgs::msg::TrafficSignal() const
 {
   autoware_auto_perception_msgs::msg::TrafficSignal traffic_signal;
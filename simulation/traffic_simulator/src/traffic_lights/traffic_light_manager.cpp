@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <color_names/color_names.hpp>
 #include <iterator>
 #include <memory>
@@ -23,24 +24,36 @@
 
 namespace traffic_simulator
 {
-auto TrafficLightManagerBase::deleteAllMarkers() const -> void
-{
-  visualization_msgs::msg::MarkerArray message;
-  {
-    visualization_msgs::msg::Marker marker;
-    marker.action = marker.DELETEALL;
-    message.markers.push_back(marker);
-  }
-
-  marker_pub_->publish(message);
-}
-
-auto TrafficLightManagerBase::drawMarkers() const -> void
+auto TrafficLightManagerBase::drawMarkers(const std::vector<LaneletID> & changed_ids) const
+  -> void
 {
   visualization_msgs::msg::MarkerArray marker_array;
 
   const auto now = clock_ptr_->now();
 
+  /*
+     Markers are replaced in place by namespace and ID. A traffic light which went dark has no
+     marker to replace its previous one, so that marker is deleted explicitly.
+  */
+  for (const auto id : changed_ids) {
+    const auto & bulbs = getTrafficLights().at(id).bulbs;
+    if (std::none_of(std::begin(bulbs), std::end(bulbs), [](auto && bulb) {
+          return bulb.is(TrafficLight::Shape::Category::circle);
+        })) {
+      visualization_msgs::msg::Marker marker;
+      marker.header.stamp = now;
+      marker.header.frame_id = map_frame_;
+      marker.action = marker.DELETE;
+      marker.ns = "bulb";
+      marker.id = id;
+      marker_array.markers.push_back(marker);
+    }
+  }
+
+  /*
+     The marker topic is transient local with a depth of 1, so the last message must describe every
+     traffic light for subscribers joining later.
+  */
   for (const auto & [id, traffic_light] : getTrafficLights()) {
     traffic_light.draw(marker_array.markers, now, map_frame_);
   }
@@ -48,42 +61,71 @@ auto TrafficLightManagerBase::drawMarkers() const -> void
   marker_pub_->publish(marker_array);
 }
 
-auto TrafficLightManagerBase::hasAnyLightChanged() -> bool
+auto TrafficLightManagerBase::getChangedTrafficLightIds(const TrafficLightStates & states) const
+  -> std::vector<LaneletID>
+{
+  std::vector<LaneletID> changed_ids;
+  for (const auto & [id, traffic_light] : getTrafficLights()) {
+    if (const auto iter = states.find(id);
+        iter == std::end(states) or iter->second != traffic_light.hashes()) {
+      changed_ids.push_back(id);
+    }
+  }
+  return changed_ids;
+}
+
+auto TrafficLightManagerBase::takeChangedTrafficLightIds(TrafficLightStates & states) const
+  -> std::vector<LaneletID>
 {
-  return true;
-  // return std::any_of(
-  //   std::begin(getTrafficLights()), std::end(getTrafficLights()), [](auto && id_and_traffic_light) {
-  //     return id_and_traffic_light.second.colorChanged() or
-  //            id_and_traffic_light.second.arrowChanged();
-  //   });
+  const auto changed_ids = getChangedTrafficLightIds(states);
+  for (const auto id : changed_ids) {
+    states[id] = getTrafficLights().at(id).hashes();
+  }
+  return changed_ids;
+}
+
+auto TrafficLightManagerBase::hasAnyLightChanged() const -> bool
+{
+  return std::any_of(
+    std::begin(getTrafficLights()), std::end(getTrafficLights()), [this](auto && id_and_light) {
+      const auto iter = published_states_.find(id_and_light.first);
+      return iter == std::end(published_states_) or
+             iter->second != id_and_light.second.hashes();
+    });
 }
 
 auto TrafficLightManagerBase::update(const double) -> void
 {
-  publishTrafficLightStateArray();
+  const auto changed_ids = takeChangedTrafficLightIds(published_states_);
 
-  if (hasAnyLightChanged()) {
-    deleteAllMarkers();
-  }
+  publishTrafficLightStateArray(changed_ids);
 
-  drawMarkers();
+  if (not changed_ids.empty()) {
+    drawMarkers(changed_ids);
+  }
 }
 
 template <>
-auto TrafficLightManager<
-  autoware_auto_perception_msgs::msg::TrafficSignalArray>::publishTrafficLightStateArray() const
-  -> void
+auto TrafficLightManager<autoware_auto_perception_msgs::msg::TrafficSignalArray>::
+  publishTrafficLightStateArray(const std::vector<LaneletID> & changed_ids) -> void
 {
-  autoware_auto_perception_msgs::msg::TrafficSignalArray traffic_light_state_array;
-  {
-    traffic_light_state_array.header.frame_id = "camera_link";  // DIRTY HACK!!!
-    traffic_light_state_array.header.stamp = clock_ptr_->now();
-    for (const auto & [id, traffic_light] : getTrafficLights()) {
-      traffic_light_state_array.signals.push_back(
-        static_cast<autoware_auto_perception_msgs::msg::TrafficSignal>(traffic_light));
+  /*
+     Subscribers regard a traffic light missing from the array as unknown, so every traffic light
+     is published each frame. Only the signals of the changed traffic lights are rebuilt.
+  */
+  for (const auto id : changed_ids) {
+    auto signal =
+      static_cast<autoware_auto_perception_msgs::msg::TrafficSignal>(getTrafficLights().at(id));
+    if (const auto iter = signal_indices_.find(id); iter != std::end(signal_indices_)) {
+      traffic_light_state_array_.signals[iter->second] = std::move(signal);
+    } else {
+      signal_indices_.emplace(id, traffic_light_state_array_.signals.size());
+      traffic_light_state_array_.signals.push_back(std::move(signal));
     }
   }
-  traffic_light_state_array_publisher_->publish(traffic_light_state_array);
+  traffic_light_state_array_.header.frame_id = "camera_link";  // DIRTY HACK!!!
+  traffic_light_state_array_.header.stamp = clock_ptr_->now();
+  traffic_light_state_array_publisher_->publish(traffic_light_state_array_);
 }
 
 template <>
@@ -0,0 +1,93 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <memory>
+#include <string>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/entity/misc_object_entity.hpp>
+
+#include "../catalogs.hpp"
+
+namespace
+{
+/*
+   An entity whose next status depends on the statuses of its neighbours, so
+   that reading a neighbour which was already updated in the same frame would
+   change the result.
+*/
+class FollowingEntity : public traffic_simulator::entity::MiscObjectEntity
+{
+public:
+  using MiscObjectEntity::MiscObjectEntity;
+
+  void onUpdate(double current_time, double step_time) override
+  {
+    MiscObjectEntity::onUpdate(current_time, step_time);
+    auto status = getStatus();
+    double speed = 1.0;
+    for (const auto & other : other_status_) {
+      if (status.pose.position.x < other.second.pose.position.x) {
+        speed += 0.5;
+      }
+    }
+    status.action_status.twist.linear.x = speed;
+    status.pose.position.x += speed * step_time;
+    setStatus(status);
+  }
+};
+
+auto makeEntityManager(const rclcpp::Node::SharedPtr & node, bool parallel_npc_update)
+{
+  auto configuration = traffic_simulator::Configuration(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map");
+  configuration.parallel_npc_update = parallel_npc_update;
+  return std::make_unique<traffic_simulator::entity::EntityManager>(node, configuration);
+}
+}  // namespace
+
+TEST(EntityManager, ParallelNpcUpdateMatchesSerialUpdate)
+{
+  const auto serial_node = std::make_shared<rclcpp::Node>("serial");
+  const auto parallel_node = std::make_shared<rclcpp::Node>("parallel");
+  const auto serial = makeEntityManager(serial_node, false);
+  const auto parallel = makeEntityManager(parallel_node, true);
+  for (auto * entity_manager : {serial.get(), parallel.get()}) {
+    for (int i = 0; i < 64; ++i) {
+      const auto name = "npc" + std::to_string(i);
+      entity_manager->spawnEntity<FollowingEntity>(name, getMiscObjectParameters());
+      traffic_simulator_msgs::msg::EntityStatus status;
+      status.pose.position.x = (i % 8) * 5.0;
+      status.pose.position.y = (i / 8) * 5.0;
+      entity_manager->setEntityStatus(name, status);
+    }
+  }
+  constexpr double step_time = 0.1;
+  for (int frame = 0; frame < 20; ++frame) {
+    serial->update(frame * step_time, step_time);
+    parallel->update(frame * step_time, step_time);
+  }
+  for (const auto & name : serial->getEntityNames()) {
+    EXPECT_EQ(serial->getEntityStatus(name), parallel->getEntityStatus(name)) << name;
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  return RUN_ALL_TESTS();
+}
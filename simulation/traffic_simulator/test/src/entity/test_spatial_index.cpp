@@ -0,0 +1,67 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <traffic_simulator/entity/spatial_index.hpp>
+#include <traffic_simulator_msgs/msg/entity_status.hpp>
+#include <unordered_map>
+
+namespace
+{
+traffic_simulator_msgs::msg::EntityStatus makeStatus(double x, double y)
+{
+  traffic_simulator_msgs::msg::EntityStatus status;
+  status.pose.position.x = x;
+  status.pose.position.y = y;
+  return status;
+}
+}  // namespace
+
+TEST(SpatialIndex, EntityNamesWithin)
+{
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> statuses;
+  statuses.emplace("origin", makeStatus(0, 0));
+  statuses.emplace("near", makeStatus(29, 0));
+  statuses.emplace("negative", makeStatus(-10, -10));
+  statuses.emplace("boundary", makeStatus(0, 30));
+  statuses.emplace("far", makeStatus(100, 100));
+  traffic_simulator::entity::SpatialIndex spatial_index;
+  spatial_index.build(statuses);
+  auto names = spatial_index.getEntityNamesWithin(makeStatus(0, 0).pose.position, 30);
+  std::sort(names.begin(), names.end());
+  EXPECT_EQ(names, (std::vector<std::string>{"near", "negative", "origin"}));
+  names = spatial_index.getEntityNamesWithin(makeStatus(100, 100).pose.position, 1);
+  EXPECT_EQ(names, (std::vector<std::string>{"far"}));
+}
+
+TEST(SpatialIndex, Rebuild)
+{
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> statuses;
+  statuses.emplace("entity", makeStatus(0, 0));
+  traffic_simulator::entity::SpatialIndex spatial_index;
+  spatial_index.build(statuses);
+  statuses["entity"] = makeStatus(200, 0);
+  spatial_index.build(statuses);
+  EXPECT_TRUE(spatial_index.getEntityNamesWithin(makeStatus(0, 0).pose.position, 30).empty());
+  EXPECT_EQ(spatial_index.getEntityNamesWithin(makeStatus(200, 0).pose.position, 30).size(), 1u);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -14,10 +14,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <ament_index_cpp/get_package_share_directory.hpp>
+#include <boost/filesystem.hpp>
 #include <string>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/helper/helper.hpp>
+#include <vector>
 
 TEST(HdMapUtils, Construct)
 {
@@ -55,6 +58,142 @@ TEST(HdMapUtils, MatchToLane)
   }
 }
 
+TEST(HdMapUtils, CenterlineCache)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  const hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  const auto & center_points = hdmap_utils.getCenterPoints(34513);
+  EXPECT_GE(center_points.size(), static_cast<std::size_t>(3));
+  EXPECT_EQ(&center_points, &hdmap_utils.getCenterPoints(34513));
+  EXPECT_DOUBLE_EQ(hdmap_utils.getCenterPointsSpline(34513)->getPoint(0).x, center_points[0].x);
+  EXPECT_DOUBLE_EQ(hdmap_utils.getCenterPointsSpline(34513)->getPoint(0).y, center_points[0].y);
+  EXPECT_GT(hdmap_utils.getLaneletLength(34513), 0.0);
+  EXPECT_THROW(hdmap_utils.getCenterPoints(-1), common::SimulationError);
+  EXPECT_THROW(hdmap_utils.getLaneletLength(-1), common::SimulationError);
+}
+
+TEST(HdMapUtils, MapCache)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  const auto map_cache_directory = boost::filesystem::temp_directory_path() /
+                                   boost::filesystem::unique_path("map_cache-%%%%-%%%%-%%%%");
+  hdmap_utils::HdMapUtils preprocessed(path, origin, map_cache_directory);
+  const auto cache_files = std::vector<boost::filesystem::path>(
+    boost::filesystem::directory_iterator(map_cache_directory),
+    boost::filesystem::directory_iterator());
+  hdmap_utils::HdMapUtils cached(path, origin, map_cache_directory);
+  boost::filesystem::remove_all(map_cache_directory);
+  ASSERT_EQ(cache_files.size(), static_cast<std::size_t>(1));
+  EXPECT_EQ(cache_files.front().extension(), ".bin");
+  EXPECT_EQ(preprocessed.getLoadPhaseDurations().front().first, "parse map");
+  EXPECT_EQ(cached.getLoadPhaseDurations().front().first, "load map cache");
+  const auto lanelet_ids = preprocessed.getLaneletIds();
+  EXPECT_EQ(lanelet_ids.size(), cached.getLaneletIds().size());
+  for (const auto lanelet_id : lanelet_ids) {
+    EXPECT_DOUBLE_EQ(
+      preprocessed.getLaneletLength(lanelet_id), cached.getLaneletLength(lanelet_id));
+    const auto & expected = preprocessed.getCenterPoints(lanelet_id);
+    const auto & actual = cached.getCenterPoints(lanelet_id);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      EXPECT_DOUBLE_EQ(expected[i].x, actual[i].x);
+      EXPECT_DOUBLE_EQ(expected[i].y, actual[i].y);
+      EXPECT_DOUBLE_EQ(expected[i].z, actual[i].z);
+    }
+  }
+  EXPECT_EQ(preprocessed.getNextLaneletIds(34513), cached.getNextLaneletIds(34513));
+}
+
+TEST(HdMapUtils, LaneletGraph)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  const hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  const auto next_ids = hdmap_utils.getNextLaneletIds(34513);
+  EXPECT_NE(std::find(next_ids.begin(), next_ids.end(), 34510), next_ids.end());
+  const auto previous_ids = hdmap_utils.getPreviousLaneletIds(34513);
+  EXPECT_NE(std::find(previous_ids.begin(), previous_ids.end(), 34684), previous_ids.end());
+  for (const auto next_id : next_ids) {
+    const auto ids = hdmap_utils.getPreviousLaneletIds(next_id);
+    EXPECT_NE(std::find(ids.begin(), ids.end(), 34513), ids.end());
+  }
+  EXPECT_THROW(hdmap_utils.getNextLaneletIds(-1), common::SimulationError);
+}
+
+TEST(HdMapUtils, LongitudinalDistance)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  const auto distance = hdmap_utils.getLongitudinalDistance(34513, 1.0, 34510, 2.0);
+  ASSERT_TRUE(distance);
+  EXPECT_DOUBLE_EQ(distance.get(), hdmap_utils.getLaneletLength(34513) + 1.0);
+  EXPECT_FALSE(hdmap_utils.getLongitudinalDistance(34513, 2.0, 34513, 1.0));
+}
+
+TEST(HdMapUtils, LongitudinalDistanceMultiHop)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  std::vector<std::int64_t> lanelet_ids = {34513};
+  while (lanelet_ids.size() < 5) {
+    const auto next_ids = hdmap_utils.getNextLaneletIds(lanelet_ids.back());
+    ASSERT_FALSE(next_ids.empty());
+    lanelet_ids.push_back(next_ids.front());
+  }
+  for (const auto to_lanelet_id : lanelet_ids) {
+    const auto route = hdmap_utils.getRoute(34513, to_lanelet_id);
+    ASSERT_FALSE(route.empty());
+    double expected = 2.0 - 1.0;
+    for (std::size_t i = 0; i + 1 < route.size(); ++i) {
+      expected += hdmap_utils.getLaneletLength(route[i]);
+    }
+    const auto distance = hdmap_utils.getLongitudinalDistance(34513, 1.0, to_lanelet_id, 2.0);
+    ASSERT_TRUE(distance);
+    EXPECT_NEAR(distance.get(), expected, 1e-3);
+  }
+}
+
+TEST(HdMapUtils, LongitudinalDistanceBeyondHorizon)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils indexed(path, origin);
+  hdmap_utils::HdMapUtils bounded(path, origin, "", 50.0);
+  hdmap_utils::HdMapUtils routed(path, origin, "", 0.0);  // Every lookup falls back to getRoute.
+  for (const auto to_lanelet_id : routed.getLaneletIds()) {
+    const auto expected = routed.getLongitudinalDistance(34513, 1.0, to_lanelet_id, 2.0);
+    for (auto * hdmap_utils : {&indexed, &bounded}) {
+      const auto distance = hdmap_utils->getLongitudinalDistance(34513, 1.0, to_lanelet_id, 2.0);
+      ASSERT_EQ(static_cast<bool>(distance), static_cast<bool>(expected)) << to_lanelet_id;
+      if (expected) {
+        EXPECT_NEAR(distance.get(), expected.get(), 1e-3) << to_lanelet_id;
+      }
+    }
+  }
+}
+
 TEST(HdMapUtils, AlongLaneletPose)
 {
   std::string path =
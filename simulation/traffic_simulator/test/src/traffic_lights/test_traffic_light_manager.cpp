@@ -93,6 +93,40 @@ TEST(TrafficLightManager, setArrow)
   }
 }
 
+TEST(TrafficLightManager, trackChanges)
+{
+  const auto node = std::make_shared<rclcpp::Node>("trackChanges");
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  const auto hdmap_utils_ptr = std::make_shared<hdmap_utils::HdMapUtils>(path, origin);
+  traffic_simulator::TrafficLightManager<autoware_auto_perception_msgs::msg::TrafficSignalArray>
+    manager(hdmap_utils_ptr, node, "map");
+  using Color = traffic_simulator::TrafficLight::Color;
+  manager.getTrafficLight(34836).emplace(Color::green);
+  manager.getTrafficLight(34802).emplace(Color::red);
+  EXPECT_TRUE(manager.hasAnyLightChanged());
+  EXPECT_EQ(manager.getChangedTrafficLightIdsForSimulator().size(), static_cast<std::size_t>(2));
+  manager.update(0.05);
+  EXPECT_FALSE(manager.hasAnyLightChanged());
+  EXPECT_EQ(manager.getChangedTrafficLightIdsForSimulator().size(), static_cast<std::size_t>(2));
+  manager.acceptTrafficLightStatesBySimulator();
+  EXPECT_TRUE(manager.getChangedTrafficLightIdsForSimulator().empty());
+  manager.getTrafficLight(34836).clear();
+  manager.getTrafficLight(34836).emplace(Color::green);
+  EXPECT_FALSE(manager.hasAnyLightChanged());
+  manager.getTrafficLight(34836).clear();
+  manager.getTrafficLight(34836).emplace(Color::yellow);
+  EXPECT_TRUE(manager.hasAnyLightChanged());
+  EXPECT_EQ(manager.getChangedTrafficLightIdsForSimulator(), std::vector<std::int64_t>({34836}));
+  manager.acceptTrafficLightStatesBySimulator();
+  EXPECT_TRUE(manager.getChangedTrafficLightIdsForSimulator().empty());
+  manager.update(0.05);
+  EXPECT_FALSE(manager.hasAnyLightChanged());
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -59,6 +59,11 @@ struct TestControlParameters
   SimulatorType simulator_type = SimulatorType::SIMPLE_SENSOR_SIMULATOR;
   ArchitectureType architecture_type = ArchitectureType::AWF_UNIVERSE;
   std::string simulator_host = "localhost";
+  std::string transport_protocol = "tcp";
+  bool cache_preprocessed_map = false;
+  bool parallel_npc_update = false;
+  bool entity_status_delta_encoding = false;
+  bool combine_frame_requests = false;
 };
 
 struct TestSuiteParameters
@@ -86,6 +86,22 @@ class RandomTestRunnerLaunch(object):
                 {"default": "localhost",
                  "description": "Simulation host. It can be either IP address "
                                 "or the host name that is resolvable in the environment"},
+            "transport_protocol": {"default": "tcp", "description": "Transport to the simulator",
+                                   "values": ["tcp", "ipc"]},
+            "cache_preprocessed_map":
+                {"default": False,
+                 "description": "If true, the preprocessed lanelet map is cached in the user's cache directory "
+                                "and reused while the map does not change"},
+            "parallel_npc_update":
+                {"default": False,
+                 "description": "If true, the behaviors of NPCs are updated on all hardware threads"},
+            "entity_status_delta_encoding":
+                {"default": False,
+                 "description": "If true, only the entities whose status changed are sent to the simulator"},
+            "combine_frame_requests":
+                {"default": False,
+                 "description": "If true, all requests of a frame are sent to the simulator at once. "
+                                "Only for simulators serving update_step (simple_sensor_simulator)"},
 
             # control arguments #
             "test_count": {"default": 5, "description": "Test count to be performed in test suite"},
@@ -239,7 +255,9 @@ class RandomTestRunnerLaunch(object):
                     namespace="simulation",
                     output="log",
                     arguments=[("__log_level:=warn")],
-                    parameters=[{"port": 8080}],
+                    parameters=[{"port": 8080,
+                                 "transport_protocol":
+                                     self.random_test_runner_launch_configuration["transport_protocol"]}],
                 ),
             )
 
@@ -66,6 +66,13 @@ RandomTestRunner::RandomTestRunner(const rclcpp::NodeOptions & option)
 
   traffic_simulator::Configuration configuration(map_path);
   configuration.simulator_host = test_control_parameters.simulator_host;
+  configuration.cache_preprocessed_map = test_control_parameters.cache_preprocessed_map;
+  configuration.parallel_npc_update = test_control_parameters.parallel_npc_update;
+  configuration.entity_status_delta_encoding =
+    test_control_parameters.entity_status_delta_encoding;
+  configuration.combine_frame_requests = test_control_parameters.combine_frame_requests;
+  configuration.transport_protocol =
+    simulation_interface::toTransportProtocol(test_control_parameters.transport_protocol);
   api_ = std::make_shared<traffic_simulator::API>(this, configuration);
   auto lanelet_utils = std::make_shared<LaneletUtils>(configuration.lanelet2_map_path());
 
@@ -144,6 +151,12 @@ TestControlParameters RandomTestRunner::collectAndValidateTestControlParameters(
   tp.architecture_type =
     architectureTypeFromString(this->declare_parameter<std::string>("architecture_type", ""));
   tp.simulator_host = this->declare_parameter<std::string>("simulator_host", "localhost");
+  tp.cache_preprocessed_map = this->declare_parameter<bool>("cache_preprocessed_map", false);
+  tp.parallel_npc_update = this->declare_parameter<bool>("parallel_npc_update", false);
+  tp.entity_status_delta_encoding =
+    this->declare_parameter<bool>("entity_status_delta_encoding", false);
+  tp.combine_frame_requests = this->declare_parameter<bool>("combine_frame_requests", false);
+  tp.transport_protocol = this->declare_parameter<std::string>("transport_protocol", "tcp");
 
   if (!tp.input_dir.empty() && !boost::filesystem::is_directory(tp.input_dir)) {
     throw std::runtime_error(
@@ -56,56 +56,74 @@ def default_autoware_launch_file_of(architecture_type):
 
 def launch_setup(context, *args, **kwargs):
     # fmt: off
-    architecture_type       = LaunchConfiguration("architecture_type",       default="awf/universe")
-    autoware_launch_file    = LaunchConfiguration("autoware_launch_file",    default=default_autoware_launch_file_of(architecture_type.perform(context)))
-    autoware_launch_package = LaunchConfiguration("autoware_launch_package", default=default_autoware_launch_package_of(architecture_type.perform(context)))
-    global_frame_rate       = LaunchConfiguration("global_frame_rate",       default=30.0)
-    global_real_time_factor = LaunchConfiguration("global_real_time_factor", default=1.0)
-    global_timeout          = LaunchConfiguration("global_timeout",          default=180)
-    initialize_duration     = LaunchConfiguration("initialize_duration",     default=30)
-    launch_autoware         = LaunchConfiguration("launch_autoware",         default=True)
-    launch_rviz             = LaunchConfiguration("launch_rviz",             default=False)
-    output_directory        = LaunchConfiguration("output_directory",        default=Path("/tmp"))
-    port                    = LaunchConfiguration("port",                    default=8080)
-    record                  = LaunchConfiguration("record",                  default=True)
-    rviz_config             = LaunchConfiguration("rviz_config",             default="")
-    scenario                = LaunchConfiguration("scenario",                default=Path("/dev/null"))
-    sensor_model            = LaunchConfiguration("sensor_model",            default="")
-    sigterm_timeout         = LaunchConfiguration("sigterm_timeout",         default=8)
-    vehicle_model           = LaunchConfiguration("vehicle_model",           default="")
-    workflow                = LaunchConfiguration("workflow",                default=Path("/dev/null"))
+    architecture_type            = LaunchConfiguration("architecture_type",            default="awf/universe")
+    autoware_launch_file         = LaunchConfiguration("autoware_launch_file",         default=default_autoware_launch_file_of(architecture_type.perform(context)))
+    autoware_launch_package      = LaunchConfiguration("autoware_launch_package",      default=default_autoware_launch_package_of(architecture_type.perform(context)))
+    cache_preprocessed_map       = LaunchConfiguration("cache_preprocessed_map",       default=False)
+    combine_frame_requests       = LaunchConfiguration("combine_frame_requests",       default=False)
+    entity_status_delta_encoding = LaunchConfiguration("entity_status_delta_encoding", default=False)
+    fast_forward                 = LaunchConfiguration("fast_forward",                 default=False)
+    global_frame_rate            = LaunchConfiguration("global_frame_rate",            default=30.0)
+    global_real_time_factor      = LaunchConfiguration("global_real_time_factor",      default=1.0)
+    global_timeout               = LaunchConfiguration("global_timeout",               default=180)
+    initialize_duration          = LaunchConfiguration("initialize_duration",          default=30)
+    launch_autoware              = LaunchConfiguration("launch_autoware",              default=True)
+    launch_rviz                  = LaunchConfiguration("launch_rviz",                  default=False)
+    output_directory             = LaunchConfiguration("output_directory",             default=Path("/tmp"))
+    parallel_npc_update          = LaunchConfiguration("parallel_npc_update",          default=False)
+    port                         = LaunchConfiguration("port",                         default=8080)
+    record                       = LaunchConfiguration("record",                       default=True)
+    rviz_config                  = LaunchConfiguration("rviz_config",                  default="")
+    scenario                     = LaunchConfiguration("scenario",                     default=Path("/dev/null"))
+    sensor_model                 = LaunchConfiguration("sensor_model",                 default="")
+    sigterm_timeout              = LaunchConfiguration("sigterm_timeout",              default=8)
+    transport_protocol           = LaunchConfiguration("transport_protocol",           default="tcp")
+    vehicle_model                = LaunchConfiguration("vehicle_model",                default="")
+    workflow                     = LaunchConfiguration("workflow",                     default=Path("/dev/null"))
     # fmt: on
 
-    print(f"architecture_type       := {architecture_type.perform(context)}")
-    print(f"autoware_launch_file    := {autoware_launch_file.perform(context)}")
-    print(f"autoware_launch_package := {autoware_launch_package.perform(context)}")
-    print(f"global_frame_rate       := {global_frame_rate.perform(context)}")
-    print(f"global_real_time_factor := {global_real_time_factor.perform(context)}")
-    print(f"global_timeout          := {global_timeout.perform(context)}")
-    print(f"initialize_duration     := {initialize_duration.perform(context)}")
-    print(f"launch_autoware         := {launch_autoware.perform(context)}")
-    print(f"launch_rviz             := {launch_rviz.perform(context)}")
-    print(f"output_directory        := {output_directory.perform(context)}")
-    print(f"port                    := {port.perform(context)}")
-    print(f"record                  := {record.perform(context)}")
-    print(f"rviz_config             := {rviz_config.perform(context)}")
-    print(f"scenario                := {scenario.perform(context)}")
-    print(f"sensor_model            := {sensor_model.perform(context)}")
-    print(f"sigterm_timeout         := {sigterm_timeout.perform(context)}")
-    print(f"vehicle_model           := {vehicle_model.perform(context)}")
-    print(f"workflow                := {workflow.perform(context)}")
+    print(f"architecture_type            := {architecture_type.perform(context)}")
+    print(f"autoware_launch_file         := {autoware_launch_file.perform(context)}")
+    print(f"autoware_launch_package      := {autoware_launch_package.perform(context)}")
+    print(f"cache_preprocessed_map       := {cache_preprocessed_map.perform(context)}")
+    print(f"combine_frame_requests       := {combine_frame_requests.perform(context)}")
+    print(f"entity_status_delta_encoding := {entity_status_delta_encoding.perform(context)}")
+    print(f"fast_forward                 := {fast_forward.perform(context)}")
+    print(f"global_frame_rate            := {global_frame_rate.perform(context)}")
+    print(f"global_real_time_factor      := {global_real_time_factor.perform(context)}")
+    print(f"global_timeout               := {global_timeout.perform(context)}")
+    print(f"initialize_duration          := {initialize_duration.perform(context)}")
+    print(f"launch_autoware              := {launch_autoware.perform(context)}")
+    print(f"launch_rviz                  := {launch_rviz.perform(context)}")
+    print(f"output_directory             := {output_directory.perform(context)}")
+    print(f"parallel_npc_update          := {parallel_npc_update.perform(context)}")
+    print(f"port                         := {port.perform(context)}")
+    print(f"record                       := {record.perform(context)}")
+    print(f"rviz_config                  := {rviz_config.perform(context)}")
+    print(f"scenario                     := {scenario.perform(context)}")
+    print(f"sensor_model                 := {sensor_model.perform(context)}")
+    print(f"sigterm_timeout              := {sigterm_timeout.perform(context)}")
+    print(f"transport_protocol           := {transport_protocol.perform(context)}")
+    print(f"vehicle_model                := {vehicle_model.perform(context)}")
+    print(f"workflow                     := {workflow.perform(context)}")
 
     def make_parameters():
         parameters = [
             {"architecture_type": architecture_type},
             {"autoware_launch_file": autoware_launch_file},
             {"autoware_launch_package": autoware_launch_package},
+            {"cache_preprocessed_map": cache_preprocessed_map},
+            {"combine_frame_requests": combine_frame_requests},
+            {"entity_status_delta_encoding": entity_status_delta_encoding},
+            {"fast_forward": fast_forward},
             {"initialize_duration": initialize_duration},
             {"launch_autoware": launch_autoware},
+            {"parallel_npc_update": parallel_npc_update},
             {"port": port},
             {"record": record},
             {"rviz_config": rviz_config},
             {"sensor_model": sensor_model},
+            {"transport_protocol": transport_protocol},
             {"vehicle_model": vehicle_model},
         ]
 
@@ -122,21 +140,26 @@ def launch_setup(context, *args, **kwargs):
 
     return [
         # fmt: off
-        DeclareLaunchArgument("architecture_type",       default_value=architecture_type      ),
-        DeclareLaunchArgument("autoware_launch_file",    default_value=autoware_launch_file   ),
-        DeclareLaunchArgument("autoware_launch_package", default_value=autoware_launch_package),
-        DeclareLaunchArgument("global_frame_rate",       default_value=global_frame_rate      ),
-        DeclareLaunchArgument("global_real_time_factor", default_value=global_real_time_factor),
-        DeclareLaunchArgument("global_timeout",          default_value=global_timeout         ),
-        DeclareLaunchArgument("launch_autoware",         default_value=launch_autoware        ),
-        DeclareLaunchArgument("launch_rviz",             default_value=launch_rviz            ),
-        DeclareLaunchArgument("output_directory",        default_value=output_directory       ),
-        DeclareLaunchArgument("rviz_config",             default_value=rviz_config            ),
-        DeclareLaunchArgument("scenario",                default_value=scenario               ),
-        DeclareLaunchArgument("sensor_model",            default_value=sensor_model           ),
-        DeclareLaunchArgument("sigterm_timeout",         default_value=sigterm_timeout        ),
-        DeclareLaunchArgument("vehicle_model",           default_value=vehicle_model          ),
-        DeclareLaunchArgument("workflow",                default_value=workflow               ),
+        DeclareLaunchArgument("architecture_type",            default_value=architecture_type           ),
+        DeclareLaunchArgument("autoware_launch_file",         default_value=autoware_launch_file        ),
+        DeclareLaunchArgument("autoware_launch_package",      default_value=autoware_launch_package     ),
+        DeclareLaunchArgument("cache_preprocessed_map",       default_value=cache_preprocessed_map      ),
+        DeclareLaunchArgument("combine_frame_requests",       default_value=combine_frame_requests      ),
+        DeclareLaunchArgument("entity_status_delta_encoding", default_value=entity_status_delta_encoding),
+        DeclareLaunchArgument("global_frame_rate",            default_value=global_frame_rate           ),
+        DeclareLaunchArgument("global_real_time_factor",      default_value=global_real_time_factor     ),
+        DeclareLaunchArgument("global_timeout",               default_value=global_timeout              ),
+        DeclareLaunchArgument("launch_autoware",              default_value=launch_autoware             ),
+        DeclareLaunchArgument("launch_rviz",                  default_value=launch_rviz                 ),
+        DeclareLaunchArgument("output_directory",             default_value=output_directory            ),
+        DeclareLaunchArgument("parallel_npc_update",          default_value=parallel_npc_update         ),
+        DeclareLaunchArgument("rviz_config",                  default_value=rviz_config                 ),
+        DeclareLaunchArgument("scenario",                     default_value=scenario                    ),
+        DeclareLaunchArgument("sensor_model",                 default_value=sensor_model                ),
+        DeclareLaunchArgument("sigterm_timeout",              default_value=sigterm_timeout             ),
+        DeclareLaunchArgument("transport_protocol",           default_value=transport_protocol          ),
+        DeclareLaunchArgument("vehicle_model",                default_value=vehicle_model               ),
+        DeclareLaunchArgument("workflow",                     default_value=workflow                    ),
         # fmt: on
         Node(
             package="scenario_test_runner",
@@ -162,7 +185,7 @@ def launch_setup(context, *args, **kwargs):
             namespace="simulation",
             name="simple_sensor_simulator",
             output="screen",
-            parameters=[{"port": port}],
+            parameters=[{"port": port, "transport_protocol": transport_protocol}],
         ),
         LifecycleNode(
             package="openscenario_interpreter",